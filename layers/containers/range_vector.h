@@ -21,12 +21,16 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <sstream>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "custom_containers.h"
 
@@ -559,15 +563,7 @@ class range_map {
         return iterator(impl_erase(pos.pos_));
     }
 
-    iterator erase(range<iterator> bounds) {
-        auto current = bounds.begin.pos_;
-        while (current != bounds.end.pos_) {
-            RANGE_ASSERT(!at_impl_end(current));
-            current = impl_map_.erase(current);
-        }
-        RANGE_ASSERT(current == bounds.end.pos_);
-        return current;
-    }
+    iterator erase(range<iterator> bounds) { return iterator(impl_map_.erase(bounds.begin.pos_, bounds.end.pos_)); }
 
     iterator erase(iterator first, iterator last) { return erase(range<iterator>(first, last)); }
 
@@ -746,11 +742,523 @@ class range_map {
     bool empty() const { return impl_map_.empty(); }
     size_type size() const { return impl_map_.size(); }
 
+    range_map() = default;
+    // Constructs the ImplMap from args, for example to give it an allocator
+    template <typename... Args>
+    explicit range_map(std::in_place_t, Args &&...args) : impl_map_(std::forward<Args>(args)...) {}
+
     // For configuration/debug use // Use with caution...
     ImplMap &get_implementation_map() { return impl_map_; }
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// An ordered map kept in a sorted vector, for use as the range map "ImplMap" as an alternate to std::map
+//
+// The entries are contiguous, so searches and walks don't chase node pointers, and there is no allocation per entry.
+// Inserting or erasing moves all the following entries, so this suits maps which mostly grow at the end, and are searched
+// far more often than they are modified.
+//
+// Iterators are positions in the vector. They survive reallocation, and end() stays end(), but an insert or erase changes
+// the entry referred to by the iterators after it, so only the iterators returned by the modifying call are safe to use.
+// See has_stable_iterators below.
+template <typename Key, typename T>
+class sorted_vector_map {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<key_type, mapped_type>;  // The key isn't const, as entries are moved around in the vector
+    using size_type = size_t;
+
+  private:
+    using Store = std::vector<value_type>;
+    static constexpr size_type kEndPos = std::numeric_limits<size_type>::max();
+
+  public:
+    template <typename Map_, typename Value_>
+    struct IteratorImpl {
+      public:
+        using Map = Map_;
+        using Value = Value_;
+        friend Map;
+        Value *operator->() const { return &map_->store_[pos_]; }
+        Value &operator*() const { return map_->store_[pos_]; }
+        IteratorImpl &operator++() {
+            pos_ = map_->next_pos(pos_);
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            pos_ = (pos_ == kEndPos) ? map_->store_.size() - 1 : pos_ - 1;
+            return *this;
+        }
+        bool operator==(const IteratorImpl &other) const {
+            if (at_end() && other.at_end()) {
+                return true;  // all ends are equal
+            }
+            return (map_ == other.map_) && (pos_ == other.pos_);
+        }
+        bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+        // At end()
+        IteratorImpl() : map_(nullptr), pos_(kEndPos) {}
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+        size_type get_pos() const { return pos_; }
+
+        bool at_end() const { return pos_ == kEndPos; }
+
+      protected:
+        IteratorImpl(Map *map, size_type pos) : map_(map), pos_(pos) {}
+
+      private:
+        Map *map_;
+        size_type pos_;
+    };
+    using iterator = IteratorImpl<sorted_vector_map, value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public IteratorImpl<const sorted_vector_map, const value_type> {
+        using Base = IteratorImpl<const sorted_vector_map, const value_type>;
+        friend sorted_vector_map;
+
+      public:
+        const_iterator(const iterator &it) : Base(it.get_map(), it.get_pos()) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const sorted_vector_map *map, size_type pos) : Base(map, pos) {}
+    };
+
+    iterator begin() { return iterator(this, end_pos(0)); }
+    const_iterator cbegin() const { return const_iterator(this, end_pos(0)); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, kEndPos); }
+    const_iterator cend() const { return const_iterator(this, kEndPos); }
+    const_iterator end() const { return cend(); }
+
+    iterator lower_bound(const key_type &key) { return iterator(this, lower_bound_pos(key)); }
+    const_iterator lower_bound(const key_type &key) const { return const_iterator(this, lower_bound_pos(key)); }
+    iterator upper_bound(const key_type &key) { return iterator(this, upper_bound_pos(key)); }
+    const_iterator upper_bound(const key_type &key) const { return const_iterator(this, upper_bound_pos(key)); }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) { return iterator(this, find_pos(key)); }
+    const_iterator find(const key_type &key) const { return const_iterator(this, find_pos(key)); }
+
+    size_type size() const { return store_.size(); }
+    bool empty() const { return store_.empty(); }
+    void clear() { store_.clear(); }
+    void reserve(size_type count) { store_.reserve(count); }
+
+    // The caller (range_map) guarantees the key doesn't overlap any existing entry, so there is no collision check
+    template <typename Value>
+    iterator emplace_hint(const const_iterator &hint, Value &&value) {
+        const size_type pos = insert_pos(hint.get_pos(), value.first);
+        store_.emplace(store_.begin() + pos, std::forward<Value>(value));
+        return iterator(this, pos);
+    }
+    iterator insert(const const_iterator &hint, const value_type &value) { return emplace_hint(hint, value); }
+
+    iterator erase(const const_iterator &pos) {
+        RANGE_ASSERT(!pos.at_end());
+        store_.erase(store_.begin() + pos.get_pos());
+        return iterator(this, end_pos(pos.get_pos()));
+    }
+
+    // Erases all of [first, last) at once, moving the following entries only once
+    iterator erase(const const_iterator &first, const const_iterator &last) {
+        const size_type first_pos = first.at_end() ? store_.size() : first.get_pos();
+        const size_type last_pos = last.at_end() ? store_.size() : last.get_pos();
+        store_.erase(store_.begin() + first_pos, store_.begin() + last_pos);
+        return iterator(this, end_pos(first_pos));
+    }
+
+  private:
+    size_type end_pos(size_type pos) const { return (pos < store_.size()) ? pos : kEndPos; }
+    size_type next_pos(size_type pos) const { return end_pos(pos + 1); }
+
+    size_type lower_bound_pos(const key_type &key) const {
+        auto it = std::lower_bound(store_.begin(), store_.end(), key,
+                                   [](const value_type &entry, const key_type &key) { return entry.first < key; });
+        return end_pos(static_cast<size_type>(it - store_.begin()));
+    }
+    size_type upper_bound_pos(const key_type &key) const {
+        auto it = std::upper_bound(store_.begin(), store_.end(), key,
+                                   [](const key_type &key, const value_type &entry) { return key < entry.first; });
+        return end_pos(static_cast<size_type>(it - store_.begin()));
+    }
+    size_type find_pos(const key_type &key) const {
+        const size_type pos = lower_bound_pos(key);
+        return ((pos != kEndPos) && !(key < store_[pos].first)) ? pos : kEndPos;
+    }
+
+    // Use the hint if the key belongs right before it, as when appending or infilling in order, else search
+    size_type insert_pos(size_type hint, const key_type &key) const {
+        const size_type pos = (hint == kEndPos) ? store_.size() : hint;
+        const bool before_next = (pos == store_.size()) || (key < store_[pos].first);
+        const bool after_prev = (pos == 0) || (store_[pos - 1].first < key);
+        if (before_next && after_prev) {
+            return pos;
+        }
+        const size_type lower = lower_bound_pos(key);
+        return (lower == kEndPos) ? store_.size() : lower;
+    }
+
+    Store store_;
+};
+
+// Whether iterators keep referring to the same entry when other entries are inserted or erased, as they do for std::map
+template <typename Map>
+struct has_stable_iterators : std::true_type {};
+
+// A range_map kept in a sorted vector instead of a tree. The range_map members, infill_update_range and
+// infill_update_rangegen all support it, but code holding on to iterators across modifications of the map (cached lower
+// bounds, parallel iterators...) can't use it.
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using flat_range_map = range_map<Key, T, RangeKey, sorted_vector_map<RangeKey, T>>;
+
+template <typename Key, typename T, typename RangeKey>
+struct has_stable_iterators<range_map<Key, T, RangeKey, sorted_vector_map<RangeKey, T>>> : std::false_type {};
+
+// An ordered map of ranges kept in chunks of neighboring entries, for use as the range map "ImplMap" as an alternate to
+// std::map, when maps are often copied and then modified in a few places
+//
+// Copies share the chunks, which are copied on the first modification through one of the maps sharing them. Copying the map
+// costs the copy of the chunk index, and each modification after it the copy of the chunk modified, instead of the copy of
+// every entry. The chunks count their owners atomically, so the maps sharing them can be used by different threads.
+//
+// The chunk with base b holds the entries starting in [b, base of the next chunk). A chunk grows without limit while it isn't
+// shared, and is split into chunks of kSplitEntries when a larger one is copied, so the copies made for the next
+// modifications are small.
+//
+// The non-const members only return iterators to chunks this map owns alone, which are stable as for std::map. The
+// const_iterators returned by the const members can refer to shared chunks, and become invalid when the map copies such a
+// chunk, which is when it modifies one of its entries.
+template <typename Key, typename T, typename Allocator = std::allocator<std::pair<const Key, T>>>
+class shared_chunk_map {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+    using index_type = typename key_type::index_type;
+    static constexpr size_type kSplitEntries = 32;
+
+  private:
+    using Chunk = std::map<key_type, mapped_type, std::less<key_type>, allocator_type>;
+    using ChunkPtr = std::shared_ptr<Chunk>;
+    using IndexAllocator =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<std::pair<const index_type, ChunkPtr>>;
+    using Index = std::map<index_type, ChunkPtr, std::less<index_type>, IndexAllocator>;
+
+  public:
+    template <typename Map_, typename IndexIterator_, typename ChunkIterator_, typename Value_>
+    struct IteratorImpl {
+      public:
+        using Map = Map_;
+        using IndexIterator = IndexIterator_;
+        using ChunkIterator = ChunkIterator_;
+        using Value = Value_;
+        friend shared_chunk_map;
+        Value *operator->() const { return &*chunk_pos_; }
+        Value &operator*() const { return *chunk_pos_; }
+        IteratorImpl &operator++() {
+            map_->next(*this);
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            map_->prev(*this);
+            return *this;
+        }
+        bool operator==(const IteratorImpl &other) const {
+            if (at_end() || other.at_end()) {
+                return at_end() == other.at_end();  // all ends are equal
+            }
+            return (index_pos_ == other.index_pos_) && (chunk_pos_ == other.chunk_pos_);
+        }
+        bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+        // At end()
+        IteratorImpl() : map_(nullptr), index_pos_(), chunk_pos_() {}
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+        const IndexIterator &get_index_pos() const { return index_pos_; }
+        const ChunkIterator &get_chunk_pos() const { return chunk_pos_; }
+
+        bool at_end() const { return !map_ || (index_pos_ == map_->index_.end()); }
+
+      protected:
+        IteratorImpl(Map *map, const IndexIterator &index_pos, const ChunkIterator &chunk_pos)
+            : map_(map), index_pos_(index_pos), chunk_pos_(chunk_pos) {}
+
+      private:
+        Map *map_;
+        IndexIterator index_pos_;
+        ChunkIterator chunk_pos_;
+    };
+    using iterator = IteratorImpl<shared_chunk_map, typename Index::iterator, typename Chunk::iterator, value_type>;
+    using ConstIteratorBase =
+        IteratorImpl<const shared_chunk_map, typename Index::const_iterator, typename Chunk::const_iterator, const value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public ConstIteratorBase {
+        using Base = ConstIteratorBase;
+        friend shared_chunk_map;
+
+      public:
+        const_iterator(const iterator &it) : Base(it.get_map(), it.get_index_pos(), it.get_chunk_pos()) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const shared_chunk_map *map, const typename Index::const_iterator &index_pos,
+                       const typename Chunk::const_iterator &chunk_pos)
+            : Base(map, index_pos, chunk_pos) {}
+    };
+
+    shared_chunk_map() : shared_chunk_map(allocator_type()) {}
+    explicit shared_chunk_map(const allocator_type &allocator) : allocator_(allocator), index_(IndexAllocator(allocator)) {}
+    // Shares all the chunks of other, the new chunks are allocated from allocator
+    shared_chunk_map(const shared_chunk_map &other, const allocator_type &allocator)
+        : allocator_(allocator), index_(other.index_, IndexAllocator(allocator)), size_(other.size_) {}
+    shared_chunk_map(const shared_chunk_map &other)
+        : shared_chunk_map(other,
+                           std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.allocator_)) {}
+    shared_chunk_map(shared_chunk_map &&other) = default;
+    shared_chunk_map &operator=(const shared_chunk_map &other) {
+        if (this != &other) {
+            index_ = other.index_;
+            size_ = other.size_;
+        }
+        return *this;
+    }
+    shared_chunk_map &operator=(shared_chunk_map &&other) = default;
+
+    iterator begin() { return make_iterator(index_.begin()); }
+    const_iterator cbegin() const { return make_const_iterator(index_.cbegin()); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, index_.end(), typename Chunk::iterator()); }
+    const_iterator cend() const { return const_iterator(this, index_.cend(), typename Chunk::const_iterator()); }
+    const_iterator end() const { return cend(); }
+
+    iterator lower_bound(const key_type &key) {
+        auto index_pos = own_chunk_of(key.begin);
+        return index_pos == index_.end() ? end() : make_iterator(index_pos, index_pos->second->lower_bound(key));
+    }
+    const_iterator lower_bound(const key_type &key) const {
+        auto index_pos = chunk_of(index_, key.begin);
+        return index_pos == index_.end() ? cend() : make_const_iterator(index_pos, index_pos->second->lower_bound(key));
+    }
+    iterator upper_bound(const key_type &key) {
+        auto index_pos = own_chunk_of(key.begin);
+        return index_pos == index_.end() ? end() : make_iterator(index_pos, index_pos->second->upper_bound(key));
+    }
+    const_iterator upper_bound(const key_type &key) const {
+        auto index_pos = chunk_of(index_, key.begin);
+        return index_pos == index_.end() ? cend() : make_const_iterator(index_pos, index_pos->second->upper_bound(key));
+    }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) {
+        auto index_pos = own_chunk_of(key.begin);
+        if (index_pos == index_.end()) return end();
+        auto chunk_pos = index_pos->second->find(key);
+        return chunk_pos == index_pos->second->end() ? end() : iterator(this, index_pos, chunk_pos);
+    }
+    const_iterator find(const key_type &key) const {
+        auto index_pos = chunk_of(index_, key.begin);
+        if (index_pos == index_.end()) return cend();
+        auto chunk_pos = index_pos->second->find(key);
+        return chunk_pos == index_pos->second->cend() ? cend() : const_iterator(this, index_pos, chunk_pos);
+    }
+
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    void clear() {
+        index_.clear();
+        size_ = 0;
+    }
+
+    // The caller (range_map) guarantees the key doesn't overlap any existing entry, so there is no collision check
+    template <typename Value>
+    iterator emplace_hint(const const_iterator &hint, Value &&value) {
+        const index_type begin = value.first.begin;
+        typename Index::iterator index_pos;
+        bool hint_valid = false;
+        if (index_.empty() || begin < index_.begin()->first) {
+            index_pos = index_.emplace_hint(index_.begin(), begin, make_chunk());
+        } else {
+            index_pos = chunk_of(index_, begin);
+            // A hint into a chunk this map didn't own is stale once the chunk is copied
+            hint_valid = !make_unique(index_pos) && (hint.get_index_pos() == index_pos);
+            index_pos = chunk_of(index_, begin);
+        }
+        Chunk &chunk = *index_pos->second;
+        const auto chunk_hint = hint_valid ? hint.get_chunk_pos() : chunk.cend();
+        auto chunk_pos = chunk.emplace_hint(chunk_hint, std::forward<Value>(value));
+        ++size_;
+        return iterator(this, index_pos, chunk_pos);
+    }
+    iterator insert(const const_iterator &hint, const value_type &value) { return emplace_hint(hint, value); }
+
+    iterator erase(const const_iterator &pos) {
+        RANGE_ASSERT(!pos.at_end());
+        iterator it = make_mutable(pos);
+        Chunk &chunk = *it.index_pos_->second;
+        auto next = chunk.erase(it.chunk_pos_);
+        --size_;
+        if (chunk.empty()) {
+            return make_iterator(index_.erase(it.index_pos_));
+        }
+        if (next == chunk.end()) {
+            return make_iterator(std::next(it.index_pos_));
+        }
+        return iterator(this, it.index_pos_, next);
+    }
+
+    iterator erase(const const_iterator &first, const const_iterator &last) {
+        // Compare keys, not iterators, as erasing from a shared chunk copies it, leaving the iterators into it stale
+        const bool to_end = last.at_end();
+        const key_type last_key = to_end ? key_type() : last->first;
+        iterator pos = first.at_end() ? end() : make_mutable(first);
+        while (!pos.at_end() && (to_end || pos->first < last_key)) {
+            pos = erase(pos);
+        }
+        return pos;
+    }
+
+    // The number of chunks copied since construction, for testing
+    size_type chunk_copies() const { return chunk_copies_; }
+
+  private:
+    // The chunk holding the entries starting at index, or the first chunk when the index precedes all chunks
+    template <typename IndexMap>
+    static auto chunk_of(IndexMap &index, index_type begin) {
+        auto index_pos = index.upper_bound(begin);
+        if (index_pos != index.begin()) {
+            --index_pos;
+        }
+        return index_pos;
+    }
+
+    typename Index::iterator own_chunk_of(index_type begin) {
+        auto index_pos = chunk_of(index_, begin);
+        if (index_pos != index_.end() && make_unique(index_pos)) {
+            index_pos = chunk_of(index_, begin);  // the copy may have been split
+        }
+        return index_pos;
+    }
+
+    ChunkPtr make_chunk() const { return std::allocate_shared<Chunk>(allocator_, allocator_); }
+
+    // The acquire fence pairs with the release decrement of the last other owner, so this map sees all of its writes
+    static bool is_only_owner(const ChunkPtr &chunk) {
+        if (chunk.use_count() != 1) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    // Copies the chunk at index_pos unless this map owns it alone, splitting large chunks. The first piece stays at index_pos,
+    // the others are inserted right after it. Returns whether a copy was made. Chunks allocated by another map are copied even
+    // when no longer shared, as allocators like vvl::ArenaAllocator are only safe to use from the thread of their owner.
+    bool make_unique(typename Index::iterator index_pos) {
+        const ChunkPtr &chunk = index_pos->second;
+        if (is_only_owner(chunk) && chunk->get_allocator() == allocator_) {
+            return false;
+        }
+        const ChunkPtr source = chunk;
+        ++chunk_copies_;
+        if (source->size() <= 2 * kSplitEntries) {
+            index_pos->second = std::allocate_shared<Chunk>(allocator_, *source, allocator_);
+            return true;
+        }
+        const auto next_index_pos = std::next(index_pos);
+        index_pos->second = make_chunk();
+        Chunk *piece = index_pos->second.get();
+        size_type count = 0;
+        for (const auto &entry : *source) {
+            if (count == kSplitEntries) {
+                piece = index_.emplace_hint(next_index_pos, entry.first.begin, make_chunk())->second.get();
+                count = 0;
+            }
+            piece->emplace_hint(piece->end(), entry);
+            ++count;
+        }
+        return true;
+    }
+
+    // The first entry of the chunk at index_pos, made unique, or end()
+    iterator make_iterator(typename Index::iterator index_pos) {
+        if (index_pos == index_.end()) {
+            return end();
+        }
+        make_unique(index_pos);
+        return iterator(this, index_pos, index_pos->second->begin());
+    }
+    const_iterator make_const_iterator(typename Index::const_iterator index_pos) const {
+        if (index_pos == index_.cend()) {
+            return cend();
+        }
+        return const_iterator(this, index_pos, index_pos->second->cbegin());
+    }
+
+    // Moves past the end of a chunk to the beginning of the next one
+    iterator make_iterator(typename Index::iterator index_pos, typename Chunk::iterator chunk_pos) {
+        return chunk_pos == index_pos->second->end() ? make_iterator(std::next(index_pos)) : iterator(this, index_pos, chunk_pos);
+    }
+    const_iterator make_const_iterator(typename Index::const_iterator index_pos, typename Chunk::const_iterator chunk_pos) const {
+        return chunk_pos == index_pos->second->cend() ? make_const_iterator(std::next(index_pos))
+                                                      : const_iterator(this, index_pos, chunk_pos);
+    }
+
+    iterator make_mutable(const const_iterator &pos) {
+        // Read the key while the chunk pos refers to is still owned by this map
+        const key_type key = pos->first;
+        auto index_pos = index_.erase(pos.get_index_pos(), pos.get_index_pos());
+        if (make_unique(index_pos)) {
+            index_pos = chunk_of(index_, key.begin);
+            return iterator(this, index_pos, index_pos->second->find(key));
+        }
+        Chunk &chunk = *index_pos->second;
+        return iterator(this, index_pos, chunk.erase(pos.get_chunk_pos(), pos.get_chunk_pos()));
+    }
+
+    void next(iterator &it) { it = make_iterator(it.index_pos_, std::next(it.chunk_pos_)); }
+    void next(ConstIteratorBase &it) const { it = make_const_iterator(it.index_pos_, std::next(it.chunk_pos_)); }
+
+    void prev(iterator &it) {
+        if (!it.at_end() && it.chunk_pos_ != it.index_pos_->second->begin()) {
+            --it.chunk_pos_;
+            return;
+        }
+        // Pieces split from the previous chunk are inserted before it.index_pos_, so look it up again after the copy
+        const auto next_index_pos = it.index_pos_;
+        make_unique(std::prev(next_index_pos));
+        it.index_pos_ = std::prev(next_index_pos);
+        it.chunk_pos_ = std::prev(it.index_pos_->second->end());
+    }
+    void prev(ConstIteratorBase &it) const {
+        if (!it.at_end() && it.chunk_pos_ != it.index_pos_->second->cbegin()) {
+            --it.chunk_pos_;
+            return;
+        }
+        --it.index_pos_;
+        it.chunk_pos_ = std::prev(it.index_pos_->second->cend());
+    }
+
+    allocator_type allocator_;
+    Index index_;
+    size_type size_ = 0;
+    size_type chunk_copies_ = 0;
+};
+
+// A range_map whose copies share their entries until modified, see shared_chunk_map
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using shared_chunk_range_map = range_map<Key, T, RangeKey, shared_chunk_map<RangeKey, T>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -1634,6 +2142,27 @@ Iterator split(Iterator in, Map &map, const Range &range) {
     return pos;
 }
 
+// Advance pos, which must be at or before the lower_bound of range, to the lower_bound of range.
+// When walking a sorted stream of ranges the next lower bound is usually only a few entries ahead of the previous one, so
+// those are stepped over first, and only a range further away pays for the O(log n) search.
+template <typename RangeMap, typename Iterator>
+Iterator seek_lower_bound(RangeMap &map, Iterator pos, const typename RangeMap::key_type &range) {
+    constexpr int kMaxLinearSteps = 4;
+    const auto end = map.end();
+    for (int step = 0; step < kMaxLinearSteps; ++step) {
+        if ((pos == end) || !pos->first.strictly_less(range)) {
+            assert(pos == map.lower_bound(range));
+            return pos;
+        }
+        ++pos;
+    }
+    if ((pos != end) && pos->first.strictly_less(range)) {
+        pos = map.lower_bound(range);
+    }
+    assert(pos == map.lower_bound(range));
+    return pos;
+}
+
 // Apply an operation over a range map, infilling where content is absent, updating where content is present.
 // The passed pos must *either* be strictly less than range or *is* lower_bound (which may be end)
 // Trims to range boundaries.
@@ -1655,15 +2184,8 @@ Iterator infill_update_range(RangeMap &map, Iterator pos, const typename RangeMa
         assert(end == map.lower_bound(range));
     } else if (pos->first.strictly_less(range)) {
         // pos isn't lower_bound for range (it's less than range), however, if range is monotonically increasing it's likely
-        // the next entry in the map will be the lower bound.
-
-        // If the new (pos + 1) *isn't* stricly_less and pos is,
-        // (pos + 1) must be the lower_bound, otherwise we have to look for it O(log n)
-        ++pos;
-        if ((pos != end) && pos->first.strictly_less(range)) {
-            pos = map.lower_bound(range);
-        }
-        assert(pos == map.lower_bound(range));
+        // the lower bound is close by
+        pos = seek_lower_bound(map, pos, range);
     }
 
     if ((pos != end) && (range.begin > pos->first.begin)) {
@@ -1679,7 +2201,12 @@ Iterator infill_update_range(RangeMap &map, Iterator pos, const typename RangeMa
 
         if (current_begin < pos->first.begin) {
             // We have a gap to infill (we supply pos for ("insert in front of" calls)
+            const KeyType next_key = pos->first;
             ops.infill(map, pos, KeyType(current_begin, std::min(range.end, pos->first.begin)));
+            if constexpr (!has_stable_iterators<RangeMap>::value) {
+                // Entries inserted in front of pos moved the entry pos referred to
+                pos = seek_lower_bound(map, pos, next_key);
+            }
             // Advance current begin, but *not* pos as it's the next valid value. (infill shall not invalidate pos)
             current_begin = pos->first.begin;
         } else {
@@ -1713,11 +2240,20 @@ void infill_update_range(RangeMap &map, const typename RangeMap::key_type &range
     infill_update_range(map, pos, range, ops);
 }
 
+// Batched form of infill_update_range for a strictly monotonic stream of ranges (for example the ranges of an image
+// subresource range), walking the map once from the first lower_bound instead of searching for each range.
+// Abutting ranges are applied as one, so map entries spanning them aren't split at each range boundary.
 template <typename RangeMap, typename RangeGen, typename InfillUpdateOps>
 void infill_update_rangegen(RangeMap &map, RangeGen &range_gen, const InfillUpdateOps &ops) {
+    using KeyType = typename RangeMap::key_type;
+    if (!range_gen->non_empty()) return;
     auto pos = map.lower_bound(*range_gen);
-    for (; range_gen->non_empty(); ++range_gen) {
-        pos = infill_update_range(map, pos, *range_gen, ops);
+    while (range_gen->non_empty()) {
+        KeyType range = *range_gen;
+        for (++range_gen; range_gen->non_empty() && (range_gen->begin == range.end); ++range_gen) {
+            range.end = range_gen->end;
+        }
+        pos = infill_update_range(map, pos, range, ops);
     }
 }
 
@@ -1993,15 +2529,15 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     return updated;
 }
 
-//  combines directly adjacent ranges with equal RangeMap::mapped_type .
+//  combines directly adjacent ranges with equal RangeMap::mapped_type within [first, last). last itself is never merged.
 template <typename RangeMap>
-void consolidate(RangeMap &map) {
+void consolidate(RangeMap &map, typename RangeMap::iterator first, typename RangeMap::iterator last) {
     using Value = typename RangeMap::value_type;
     using Key = typename RangeMap::key_type;
     using It = typename RangeMap::iterator;
 
-    It current = map.begin();
-    const It map_end = map.end();
+    It current = first;
+    const It map_end = last;
 
     // To be included in a merge range there must be no gap in the Key space, and the mapped_type values must match
     auto can_merge = [](const It &last, const It &cur) {
@@ -2032,6 +2568,12 @@ void consolidate(RangeMap &map) {
     }
 }
 
+//  combines directly adjacent ranges with equal RangeMap::mapped_type .
+template <typename RangeMap>
+void consolidate(RangeMap &map) {
+    consolidate(map, map.begin(), map.end());
+}
+
 }  // namespace sparse_container
 
 // Returns the intersection of the ranges [x, x + x_size) and [y, y + y_size)
@@ -0,0 +1,263 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// A concurrent map whose keys are chosen by the container on insertion.
+//
+// The key encodes the index of the slot holding the value (low 32 bits, biased by one so a key is never 0) and a
+// generation counter (high 32 bits) that is bumped each time a slot is recycled, so keys of erased elements do not alias
+// keys handed out later. Lookups are a bounds check, an index into a segment and a compare of the stored key, with no
+// locks taken. Slots are stored in fixed size segments that are never moved or freed before the container is destroyed,
+// so concurrent readers never observe a dangling slot.
+//
+// Only insertion of new elements and recycling of erased slots are serialized (and only when the free list is used).
+//
+// The interface mirrors the subset of vvl::concurrent_unordered_map used for handle wrapping, so both can be used
+// interchangeably there.
+//
+// Each element also has room for one attachment: a pointer owned by some other structure that wants to find its data for
+// a key without a lookup of its own. Erasing the element clears its attachment, the owner stays responsible for freeing it.
+template <typename T, uint32_t SegmentSizeLog2 = 12, uint32_t MaxSegmentsLog2 = 14>
+class concurrent_slot_map {
+    static_assert(std::is_trivially_copyable_v<T>, "concurrent_slot_map values are stored in std::atomic");
+
+  public:
+    using key_type = uint64_t;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, T>;
+
+    static constexpr uint32_t kSegmentSize = 1u << SegmentSizeLog2;
+    static constexpr uint32_t kMaxSegments = 1u << MaxSegmentsLog2;
+    static constexpr uint64_t kMaxSlots = uint64_t(kSegmentSize) * kMaxSegments;
+    static_assert(kMaxSlots < (uint64_t(1) << 32), "slot index must fit in the low 32 bits of the key");
+
+    // Same shape as the result of vvl::concurrent_unordered_map::find(): holds a copy of the value
+    class FindResult {
+      public:
+        FindResult() : found_(false), result_(0, T{}) {}
+        FindResult(key_type key, T value) : found_(true), result_(key, value) {}
+
+        bool operator==(const FindResult &other) const {
+            if (found_ != other.found_) return false;
+            return !found_ || (result_.first == other.result_.first);
+        }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        std::pair<key_type, T> *operator->() { return &result_; }
+        const std::pair<key_type, T> *operator->() const { return &result_; }
+
+      private:
+        bool found_;
+        std::pair<key_type, T> result_;
+    };
+
+    concurrent_slot_map() : segments_(new std::atomic<Segment *>[kMaxSegments]) {
+        for (uint32_t i = 0; i < kMaxSegments; ++i) {
+            segments_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~concurrent_slot_map() {
+        for (uint32_t i = 0; i < kMaxSegments; ++i) {
+            delete segments_[i].load(std::memory_order_relaxed);
+        }
+    }
+    concurrent_slot_map(const concurrent_slot_map &) = delete;
+    concurrent_slot_map &operator=(const concurrent_slot_map &) = delete;
+
+    // Stores value in a free slot and returns its key, or 0 if the container is full
+    key_type insert(const T &value) {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+        {
+            std::lock_guard<std::mutex> guard(free_list_lock_);
+            if (!free_list_.empty()) {
+                index = free_list_.back();
+                free_list_.pop_back();
+                generation = GetSlot(index)->generation;
+            }
+        }
+        if (generation == 0) {
+            const uint64_t next = next_unused_.fetch_add(1, std::memory_order_relaxed);
+            if (next >= kMaxSlots) {
+                return 0;
+            }
+            index = static_cast<uint32_t>(next);
+            generation = 1;
+            EnsureSegment(index >> SegmentSizeLog2);
+        }
+
+        Slot *slot = GetSlot(index);
+        slot->generation = generation;
+        const key_type key = MakeKey(index, generation);
+        // A recycled slot is overwritten while find() may still be reading it for the previous key. The fence orders the
+        // pop() that cleared the key before the new value, so a reader that sees the new value also sees the old key gone.
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->value.store(value, std::memory_order_relaxed);
+        // Publish the value before the key, readers acquire the key first
+        slot->key.store(key, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return key;
+    }
+
+    // Replaces the value of an existing element, keys can only be created by insert()
+    void insert_or_assign(key_type key, const T &value) {
+        Slot *slot = Lookup(key);
+        assert(slot);
+        if (slot) {
+            slot->value.store(value, std::memory_order_release);
+        }
+    }
+
+    FindResult find(key_type key) const {
+        const Slot *slot = Lookup(key);
+        if (!slot) return end();
+        const T value = slot->value.load(std::memory_order_relaxed);
+        // If the slot got recycled while reading, the value may belong to someone else. Same as a seqlock read, the fence
+        // keeps the key check below from being satisfied by a load that was ordered before the value load.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->key.load(std::memory_order_relaxed) != key) return end();
+        return FindResult(key, value);
+    }
+
+    FindResult end() const { return FindResult(); }
+
+    bool contains(key_type key) const { return Lookup(key) != nullptr; }
+
+    FindResult pop(key_type key) {
+        Slot *slot = Lookup(key);
+        if (!slot) return end();
+        key_type expected = key;
+        // Only one of multiple racing pops of the same key wins the slot
+        if (!slot->key.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) return end();
+        FindResult result(key, slot->value.load(std::memory_order_relaxed));
+        Release(slot, SlotIndex(key));
+        return result;
+    }
+
+    void erase(key_type key) { pop(key); }
+
+    // Attaches data to a live element. Returns false, attaching nothing, if key is not (or no longer) in the map.
+    bool attach(key_type key, void *attachment) {
+        Slot *slot = Lookup(key);
+        if (!slot) return false;
+        slot->attachment.store(attachment);
+        if (slot->key.load() == key) return true;
+        // Erased in the meantime, undo unless the slot was already recycled and attached to again
+        void *expected = attachment;
+        slot->attachment.compare_exchange_strong(expected, nullptr);
+        return false;
+    }
+
+    // Clears the attachment of key, if it still is the given one
+    void detach(key_type key, void *attachment) {
+        Slot *slot = Lookup(key);
+        if (!slot) return;
+        void *expected = attachment;
+        slot->attachment.compare_exchange_strong(expected, nullptr);
+    }
+
+    // Returns null if key is not in the map or has nothing attached. The accesses are sequentially consistent, so that
+    // owners that defer freeing attachments (e.g. until readers are quiescent) see the readers that got one.
+    void *find_attachment(key_type key) const {
+        const Slot *slot = Lookup(key);
+        if (!slot) return nullptr;
+        void *attachment = slot->attachment.load();
+        if (slot->key.load() != key) return nullptr;
+        return attachment;
+    }
+
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    // The slot index and generation encoded in a key, for containers indexed in parallel with this one. Keys with
+    // nothing in their low 32 bits, like 0, get an index past kMaxSlots.
+    static uint32_t SlotIndex(key_type key) { return static_cast<uint32_t>((key & 0xFFFFFFFFull) - 1); }
+    static uint32_t Generation(key_type key) { return static_cast<uint32_t>(key >> 32); }
+
+  private:
+    static key_type MakeKey(uint32_t index, uint32_t generation) {
+        return (uint64_t(generation) << 32) | (uint64_t(index) + 1);
+    }
+
+    struct Slot {
+        std::atomic<key_type> key{0};
+        std::atomic<T> value{};
+        std::atomic<void *> attachment{nullptr};
+        // Only touched by the thread owning the slot while it is being allocated or released
+        uint32_t generation = 0;
+    };
+    struct Segment {
+        Slot slots[kSegmentSize];
+    };
+
+    Slot *GetSlot(uint32_t index) const {
+        Segment *segment = segments_[index >> SegmentSizeLog2].load(std::memory_order_acquire);
+        assert(segment);
+        return &segment->slots[index & (kSegmentSize - 1)];
+    }
+
+    Slot *Lookup(key_type key) const {
+        if ((key & 0xFFFFFFFFull) == 0) return nullptr;
+        const uint64_t index = SlotIndex(key);
+        if (index >= kMaxSlots) return nullptr;
+        Segment *segment = segments_[index >> SegmentSizeLog2].load(std::memory_order_acquire);
+        if (!segment) return nullptr;
+        Slot *slot = &segment->slots[index & (kSegmentSize - 1)];
+        if (slot->key.load(std::memory_order_acquire) != key) return nullptr;
+        return slot;
+    }
+
+    void EnsureSegment(uint32_t segment_index) {
+        std::atomic<Segment *> &entry = segments_[segment_index];
+        if (entry.load(std::memory_order_acquire)) return;
+        auto segment = std::make_unique<Segment>();
+        Segment *expected = nullptr;
+        if (entry.compare_exchange_strong(expected, segment.get(), std::memory_order_acq_rel)) {
+            segment.release();
+        }
+    }
+
+    void Release(Slot *slot, uint32_t index) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        slot->attachment.store(nullptr);
+        // Retire the slot for good once its generation would wrap, rather than reissuing an old key
+        if (slot->generation == UINT32_MAX) return;
+        slot->generation++;
+        std::lock_guard<std::mutex> guard(free_list_lock_);
+        free_list_.push_back(index);
+    }
+
+    std::unique_ptr<std::atomic<Segment *>[]> segments_;
+    std::atomic<uint64_t> next_unused_{0};
+    std::atomic<size_t> size_{0};
+    std::mutex free_list_lock_;
+    std::vector<uint32_t> free_list_;
+};
+
+}  // namespace vvl
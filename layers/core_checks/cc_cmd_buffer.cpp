@@ -49,6 +49,7 @@ bool CoreChecks::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPoo
                                                    const VkCommandBuffer *pCommandBuffers, const ErrorObject &error_obj) const {
     bool skip = false;
     for (uint32_t i = 0; i < commandBufferCount; i++) {
+        WaitForAsyncSubmitValidation(pCommandBuffers[i]);
         auto cb_state = GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
         // Delete CB information structure, and remove from commandBufferMap
         if (cb_state && cb_state->InUse()) {
@@ -63,6 +64,7 @@ bool CoreChecks::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPoo
 
 bool CoreChecks::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                                    const ErrorObject &error_obj) const {
+    WaitForAsyncSubmitValidation(commandBuffer);
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
     if (!cb_state) return false;
     bool skip = false;
@@ -357,6 +359,7 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer,
 bool CoreChecks::PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
                                                    const ErrorObject &error_obj) const {
     bool skip = false;
+    WaitForAsyncSubmitValidation(commandBuffer);
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
     if (!cb_state) return false;
     VkCommandPool cmd_pool = cb_state->allocate_info.commandPool;
@@ -19,7 +19,6 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
-#include <fstream>
 #include <vector>
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
@@ -449,6 +448,10 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
 
     AdjustValidatorOptions(device_extensions, enabled_features, spirv_val_options, &spirv_val_option_hash);
 
+    // Without fine grained locking, every call holds the device lock and the worker thread could not run alongside them
+    async_submit_validation = global_settings.async_submit_validation && global_settings.fine_grained_locking;
+    parallel_submit_validation = global_settings.parallel_submit_validation;
+
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
         auto tmp_path = GetTempFilePath();
@@ -458,22 +461,21 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
 #endif
         validation_cache_path += ".bin";
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
+        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
+        cacheCreateInfo.initialDataSize = 0;
+        cacheCreateInfo.pInitialData = nullptr;
+        cacheCreateInfo.flags = 0;
+        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
 
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
+        // The file is used in place, so large caches don't have to be read and copied
+        auto mapped_file = vvl::MappedFile::Open(validation_cache_path.c_str());
+        if (mapped_file) {
+            validation_cache_file_appendable =
+                CastFromHandle<ValidationCache *>(core_validation_cache)->LoadMapped(std::move(mapped_file));
         } else {
             LogInfo("WARNING-cache-file-error", device, loc,
                     "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
         }
-
-        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
-        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
     }
 }
 
@@ -481,42 +483,55 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
                                             const RecordObject &record_obj) {
     if (!device) return;
 
+    WaitForAsyncSubmitValidation();
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
     if (core_validation_cache) {
         Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
-
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
-        }
-
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
+        auto cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+
+        // If the file we loaded from is still the same kind of cache and was intact, only what was added while running is
+        // appended to it. Otherwise the whole cache is written, which also drops a damaged tail and duplicate records. Either
+        // way, other processes using the same file see a complete file, or one ending with a record they detect as torn.
+        std::vector<uint32_t> header;
+        std::vector<uint32_t> new_records;
+        std::vector<uint8_t> validation_cache_data;
+        if (validation_cache_file_appendable) {
+            cache->GetFileHeader(header);
+            cache->GetNewRecords(new_records);
+        } else {
+            size_t validation_cache_size = 0;
+            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
+            validation_cache_data.resize(validation_cache_size);
+            VkResult result = CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size,
+                                                                 validation_cache_data.data());
+            if (result == VK_SUCCESS) {
+                validation_cache_data.resize(validation_cache_size);
             } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
+                LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
+                validation_cache_data.clear();
             }
         }
-        free(validation_cache_data);
+        // Unmaps the file, which must not be mapped anymore when it is replaced on some platforms
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
+        core_validation_cache = VK_NULL_HANDLE;
+
+        bool written = true;
+        if (validation_cache_path.empty()) {
+            // Nowhere to write to
+        } else if (validation_cache_file_appendable) {
+            if (!new_records.empty()) {
+                written = vvl::AppendToFile(validation_cache_path.c_str(), header.data(), header.size() * sizeof(uint32_t),
+                                            new_records.data(), new_records.size() * sizeof(uint32_t));
+            }
+        } else if (!validation_cache_data.empty()) {
+            written =
+                vvl::WriteFileAtomic(validation_cache_path.c_str(), validation_cache_data.data(), validation_cache_data.size());
+        }
+        if (!written) {
+            LogInfo("WARNING-cache-write-error", device, loc, "Cannot write shader validation cache at %s",
+                    validation_cache_path.c_str());
+        }
     }
 }
 
@@ -766,6 +781,7 @@ bool CoreChecks::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPoo
     // Verify that command buffers in pool are complete (not in-flight)
     for (auto &entry : cp_state->commandBuffers) {
         auto cb_state = entry.second;
+        WaitForAsyncSubmitValidation(*cb_state);
         if (cb_state->InUse()) {
             const LogObjectList objlist(cb_state->Handle(), commandPool);
             skip |= LogError("VUID-vkDestroyCommandPool-commandPool-00041", objlist, error_obj.location, "(%s) is in use.",
@@ -783,6 +799,7 @@ bool CoreChecks::PreCallValidateResetCommandPool(VkDevice device, VkCommandPool
     // Verify that command buffers in pool are complete (not in-flight)
     for (auto &entry : cp_state->commandBuffers) {
         auto cb_state = entry.second;
+        WaitForAsyncSubmitValidation(*cb_state);
         if (cb_state->InUse()) {
             const LogObjectList objlist(cb_state->Handle(), commandPool);
             skip |= LogError("VUID-vkResetCommandPool-commandPool-00040", objlist, error_obj.location, "(%s) is in use.",
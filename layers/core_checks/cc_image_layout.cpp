@@ -18,6 +18,7 @@
  */
 
 #include <assert.h>
+#include <algorithm>
 #include <vector>
 
 #include <vulkan/vk_enum_string_helper.h>
@@ -188,13 +189,92 @@ struct GlobalLayoutUpdater {
     }
 };
 
+// Checks the initial layouts recorded in layout_map against the current layouts of the image (the ones in overlay_map, falling
+// back to the global layouts), then applies the layouts set by layout_map to overlay_map. report(subresource, initial_layout,
+// image_layout) is called for each mismatching subresource.
+template <typename ReportFunc>
+static void CheckImageLayoutsAndUpdateOverlay(const vvl::Image &image_state,
+                                              const image_layout_map::ImageSubresourceLayoutMap::LayoutMap &layout_map,
+                                              GlobalImageLayoutRangeMap &overlay_map, const ReportFunc &report) {
+    const auto *global_map = image_state.layout_range_map.get();
+    ASSERT_AND_RETURN(global_map);
+    auto global_map_guard = global_map->ReadLock();
+
+    // Note: don't know if it would matter
+    // if (global_map->empty() && overlay_map.empty()) // skip this next loop...;
+
+    auto pos = layout_map.begin();
+    const auto end = layout_map.end();
+    sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(overlay_map, *global_map,
+                                                                                        pos->first.begin);
+    while (pos != end) {
+        VkImageLayout initial_layout = pos->second.initial_layout;
+        if (initial_layout == image_layout_map::kInvalidLayout) {
+            continue;
+        }
+
+        VkImageLayout image_layout = kInvalidLayout;
+
+        if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
+        if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
+            image_layout = current_layout->pos_A->lower_bound->second;
+        } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+            image_layout = current_layout->pos_B->lower_bound->second;
+        }
+        const auto intersected_range = pos->first & current_layout->range;
+        if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+            // TODO: Set memory invalid which is in mem_tracker currently
+        } else if (image_layout != initial_layout) {
+            const auto aspect_mask = image_state.subresource_encoder.Decode(intersected_range.begin).aspectMask;
+            const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
+            if (!matches) {
+                // We can report all the errors for the intersected range directly
+                for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
+                    report(image_state.subresource_encoder.Decode(index), initial_layout, image_layout);
+                }
+            }
+        }
+        if (pos->first.includes(intersected_range.end)) {
+            current_layout.seek(intersected_range.end);
+        } else {
+            ++pos;
+            if (pos != end) {
+                current_layout.seek(pos->first.begin);
+            }
+        }
+    }
+    // Update all layout set operations (which will be a subset of the initial_layouts)
+    sparse_container::splice(overlay_map, layout_map, GlobalLayoutUpdater());
+}
+
+bool CoreChecks::LogCmdBufImageLayoutError(const Location &loc, const vvl::CommandBuffer &cb_state, const vvl::Image &image_state,
+                                           const VkImageSubresource &subresource, VkImageLayout initial_layout,
+                                           VkImageLayout image_layout) const {
+    const LogObjectList objlist(cb_state.Handle(), image_state.Handle());
+    return LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
+                    "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32 ", mip level %" PRIu32
+                    ") to be in layout %s--instead, current layout is %s.",
+                    FormatHandle(cb_state).c_str(), FormatHandle(image_state).c_str(), subresource.aspectMask,
+                    subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
+                    string_VkImageLayout(image_layout));
+}
+
+bool CoreChecks::LogCmdBufImageLayoutErrors(const Location &loc, const vvl::CommandBuffer &cb_state,
+                                            const CmdBufImageLayoutErrors &errors) const {
+    bool skip = false;
+    for (const auto &error : errors) {
+        skip |= LogCmdBufImageLayoutError(loc, cb_state, *error.image_state, error.subresource, error.initial_layout,
+                                          error.image_layout);
+    }
+    return skip;
+}
+
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::CommandBuffer &cb_state,
                                             GlobalImageLayoutMap &overlayLayoutMap) const {
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     // Iterate over the layout maps for each referenced image
-    GlobalImageLayoutRangeMap empty_map(1);
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto image_state = Get<vvl::Image>(image);
@@ -205,65 +285,97 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         if (layout_map.empty()) continue;
 
         auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
-        const auto *global_map = image_state->layout_range_map.get();
-        ASSERT_AND_CONTINUE(global_map);
-        auto global_map_guard = global_map->ReadLock();
-
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
-
-        auto pos = layout_map.begin();
-        const auto end = layout_map.end();
-        sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(*overlay_map, *global_map,
-                                                                                            pos->first.begin);
-        while (pos != end) {
-            VkImageLayout initial_layout = pos->second.initial_layout;
-            if (initial_layout == image_layout_map::kInvalidLayout) {
-                continue;
-            }
+        CheckImageLayoutsAndUpdateOverlay(
+            *image_state, layout_map, *overlay_map,
+            [this, &skip, &loc, &cb_state, &image_state](const VkImageSubresource &subresource, VkImageLayout initial_layout,
+                                                         VkImageLayout image_layout) {
+                skip |= LogCmdBufImageLayoutError(loc, cb_state, *image_state, subresource, initial_layout, image_layout);
+            });
+    }
 
-            VkImageLayout image_layout = kInvalidLayout;
+    return skip;
+}
 
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
-                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
-                        skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
-                                         "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
-                                         FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(), subresource.aspectMask,
-                                         subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
-                                         string_VkImageLayout(image_layout));
-                    }
-                }
-            }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
-                }
+// Same as calling ValidateCmdBufImageLayouts() on each command buffer of a submission in order, with a shared overlay, but the
+// work is spread over submit_validation_pool. Errors are returned per command buffer, in the order the serial path would have
+// found them, so they can be logged with LogCmdBufImageLayoutErrors() at the point the serial path would have logged them.
+std::vector<CmdBufImageLayoutErrors> CoreChecks::ValidateCmdBufImageLayoutsParallel(
+    const std::vector<std::shared_ptr<const vvl::CommandBuffer>> &cb_states) const {
+    std::vector<CmdBufImageLayoutErrors> errors(cb_states.size());
+    if (disabled[image_layout_validation]) return errors;
+
+    // Each image has an overlay of its own, which only depends on earlier uses of the same image. So instead of going through the
+    // command buffers one after the other, each image is checked on its own, going through the command buffers using it in order.
+    struct ImageUse {
+        uint32_t cb_index;
+        // Position of the image in the command buffer's image_layout_map, to put the errors back in the serial order
+        uint32_t map_index;
+        const image_layout_map::ImageSubresourceLayoutMap::LayoutMap *layout_map;
+        CmdBufImageLayoutErrors errors;
+    };
+    struct ImageWork {
+        std::shared_ptr<const vvl::Image> image_state;
+        std::vector<ImageUse> uses;
+    };
+    std::vector<ImageWork> work;
+    vvl::unordered_map<const vvl::Image *, uint32_t> work_indices;
+
+    // Command buffers can be in a submission more than once, only lock them once
+    std::vector<ReadLockGuard> cb_guards;
+    vvl::unordered_set<const vvl::CommandBuffer *> locked_cbs;
+    for (uint32_t cb_index = 0; cb_index < cb_states.size(); ++cb_index) {
+        const vvl::CommandBuffer &cb_state = *cb_states[cb_index];
+        if (locked_cbs.insert(&cb_state).second) {
+            cb_guards.emplace_back(cb_state.ReadLock());
+        }
+        uint32_t map_index = 0;
+        for (const auto &layout_map_entry : cb_state.image_layout_map) {
+            auto image_state = Get<vvl::Image>(layout_map_entry.first);
+            if (!image_state) continue;
+            const auto &layout_map = layout_map_entry.second.map->GetLayoutMap();
+            if (layout_map.empty()) continue;
+
+            auto inserted = work_indices.emplace(image_state.get(), static_cast<uint32_t>(work.size()));
+            if (inserted.second) {
+                work.emplace_back(ImageWork{std::move(image_state), {}});
             }
+            work[inserted.first->second].uses.emplace_back(ImageUse{cb_index, map_index++, &layout_map, {}});
         }
-        // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
     }
 
-    return skip;
+    submit_validation_pool.ParallelFor(static_cast<uint32_t>(work.size()), [&work](uint32_t work_index) {
+        ImageWork &image_work = work[work_index];
+        const vvl::Image &image_state = *image_work.image_state;
+        GlobalImageLayoutRangeMap overlay_map(image_state.subresource_encoder.SubresourceCount());
+        for (auto &use : image_work.uses) {
+            CheckImageLayoutsAndUpdateOverlay(image_state, *use.layout_map, overlay_map,
+                                              [&use, &image_work](const VkImageSubresource &subresource,
+                                                                  VkImageLayout initial_layout, VkImageLayout image_layout) {
+                                                  use.errors.emplace_back(CmdBufImageLayoutError{
+                                                      image_work.image_state, subresource, initial_layout, image_layout});
+                                              });
+        }
+    });
+
+    // Merge the results back per command buffer
+    std::vector<std::vector<ImageUse *>> uses_per_cb(cb_states.size());
+    for (auto &image_work : work) {
+        for (auto &use : image_work.uses) {
+            if (!use.errors.empty()) {
+                uses_per_cb[use.cb_index].emplace_back(&use);
+            }
+        }
+    }
+    for (uint32_t cb_index = 0; cb_index < cb_states.size(); ++cb_index) {
+        auto &uses = uses_per_cb[cb_index];
+        std::sort(uses.begin(), uses.end(), [](const ImageUse *a, const ImageUse *b) { return a->map_index < b->map_index; });
+        for (auto *use : uses) {
+            auto &cb_errors = errors[cb_index];
+            cb_errors.insert(cb_errors.end(), std::make_move_iterator(use->errors.begin()),
+                             std::make_move_iterator(use->errors.end()));
+        }
+    }
+    return errors;
 }
 
 void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
@@ -988,6 +1100,7 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(const VkImageLayout expected_layo
     bool skip = false;
     if (disabled[image_layout_validation]) return false;
     if (!(image_state.layout_range_map)) return false;
+    WaitForAsyncSubmitValidation();
     const VkImageSubresourceRange subres_range = image_state.NormalizeSubresourceRange(validate_range);
     // RangeGenerator doesn't tolerate degenerate or invalid ranges. The error will be found and logged elsewhere
     if (!IsCompliantSubresourceRange(subres_range, image_state)) return false;
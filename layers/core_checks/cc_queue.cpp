@@ -23,6 +23,7 @@
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
 #include "core_validation.h"
+#include "core_checks/cc_state_tracker.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/semaphore_state.h"
 #include "state_tracker/image_state.h"
@@ -36,6 +37,9 @@ struct CommandBufferSubmitState {
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
     std::vector<VkCommandBuffer> current_cmds;
     GlobalImageLayoutMap overlay_image_layout_map;
+    // Image layout errors found ahead of time by ValidateCmdBufImageLayoutsParallel(), one entry per Validate() call
+    std::vector<CmdBufImageLayoutErrors> image_layout_errors;
+    uint32_t validated_cb_count = 0;
     std::vector<std::string> cmdbuf_label_stack;
     std::string last_closed_cmdbuf_label;
     bool found_unbalanced_cmdbuf_label;
@@ -55,15 +59,31 @@ struct CommandBufferSubmitState {
         found_unbalanced_cmdbuf_label = queue_state->found_unbalanced_cmdbuf_label;
     }
 
+    // cb_states must list the command buffers Validate() will be called with, in the same order
+    void PrevalidateImageLayouts(const std::vector<std::shared_ptr<const vvl::CommandBuffer>> &cb_states) {
+        if (core.parallel_submit_validation && !core.async_submit_validation) {
+            image_layout_errors = core.ValidateCmdBufImageLayoutsParallel(cb_states);
+        }
+    }
+
     bool Validate(const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t perf_pass) {
         bool skip = false;
-        skip |= core.ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        // In async mode, these are done by CoreChecks::EnqueueSubmitValidation() once the submission is recorded
+        if (!image_layout_errors.empty()) {
+            assert(validated_cb_count < image_layout_errors.size());
+            skip |= core.LogCmdBufImageLayoutErrors(loc, cb_state, image_layout_errors[validated_cb_count]);
+        } else if (!core.async_submit_validation) {
+            skip |= core.ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        }
+        ++validated_cb_count;
         const VkCommandBuffer cmd = cb_state.VkHandle();
         current_cmds.push_back(cmd);
         skip |= core.ValidatePrimaryCommandBufferState(
             loc, cb_state, static_cast<uint32_t>(std::count(current_cmds.begin(), current_cmds.end(), cmd)), &qfo_image_scoreboards,
             &qfo_buffer_scoreboards);
-        skip |= core.ValidateQueueFamilyIndices(loc, cb_state, *queue_state);
+        if (!core.async_submit_validation) {
+            skip |= core.ValidateQueueFamilyIndices(loc, cb_state, *queue_state);
+        }
         skip |= ValidateCmdBufLabelMatching(loc, cb_state);
 
         // Potential early exit here as bad object state may crash in delayed function calls
@@ -149,6 +169,18 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
     CommandBufferSubmitState cb_submit_state(*this, queue_state.get());
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
 
+    if (parallel_submit_validation) {
+        std::vector<std::shared_ptr<const vvl::CommandBuffer>> cb_states;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            for (uint32_t i = 0; i < pSubmits[submit_idx].commandBufferCount; i++) {
+                if (auto cb_state = Get<vvl::CommandBuffer>(pSubmits[submit_idx].pCommandBuffers[i])) {
+                    cb_states.emplace_back(std::move(cb_state));
+                }
+            }
+        }
+        cb_submit_state.PrevalidateImageLayouts(cb_states);
+    }
+
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo &submit = pSubmits[submit_idx];
@@ -317,6 +349,18 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     CommandBufferSubmitState cb_submit_state(*this, queue_state.get());
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
 
+    if (parallel_submit_validation) {
+        std::vector<std::shared_ptr<const vvl::CommandBuffer>> cb_states;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            for (uint32_t i = 0; i < pSubmits[submit_idx].commandBufferInfoCount; i++) {
+                if (auto cb_state = Get<vvl::CommandBuffer>(pSubmits[submit_idx].pCommandBufferInfos[i].commandBuffer)) {
+                    cb_states.emplace_back(std::move(cb_state));
+                }
+            }
+        }
+        cb_submit_state.PrevalidateImageLayouts(cb_states);
+    }
+
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const Location submit_loc = error_obj.location.dot(Struct::VkSubmitInfo2, Field::pSubmits, submit_idx);
@@ -406,41 +450,64 @@ void CoreChecks::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
 
     if (record_obj.result != VK_SUCCESS) return;
+    std::vector<SubmittedCommandBuffer> async_command_buffers;
     // The triply nested for duplicates that in the StateTracker, but avoids the need for two additional callbacks.
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto cb_state = GetWrite<vvl::CommandBuffer>(submit->pCommandBuffers[i]);
             if (cb_state) {
+                if (async_submit_validation) {
+                    const Location submit_loc = record_obj.location.dot(Struct::VkSubmitInfo, Field::pSubmits, submit_idx);
+                    async_command_buffers.push_back({cb_state, submit_loc.dot(Field::pCommandBuffers, i)});
+                } else {
+                    for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
+                        UpdateCmdBufImageLayouts(*secondary_cmd_buffer);
+                    }
+                    UpdateCmdBufImageLayouts(*cb_state);
+                }
                 for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
-                    UpdateCmdBufImageLayouts(*secondary_cmd_buffer);
                     RecordQueuedQFOTransfers(*secondary_cmd_buffer);
                 }
-                UpdateCmdBufImageLayouts(*cb_state);
                 RecordQueuedQFOTransfers(*cb_state);
             }
         }
     }
+    if (!async_command_buffers.empty()) {
+        EnqueueSubmitValidation(Get<vvl::Queue>(queue), std::move(async_command_buffers));
+    }
 }
 
 void CoreChecks::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
                                     const RecordObject &record_obj) {
     if (record_obj.result != VK_SUCCESS) return;
+    std::vector<SubmittedCommandBuffer> async_command_buffers;
     // The triply nested for duplicates that in the StateTracker, but avoids the need for two additional callbacks.
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2KHR *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
             auto cb_state = GetWrite<vvl::CommandBuffer>(submit->pCommandBufferInfos[i].commandBuffer);
             if (cb_state) {
+                if (async_submit_validation) {
+                    const Location info_loc = record_obj.location.dot(Struct::VkSubmitInfo2, Field::pSubmits, submit_idx)
+                                                  .dot(Struct::VkCommandBufferSubmitInfo, Field::pCommandBufferInfos, i);
+                    async_command_buffers.push_back({cb_state, info_loc.dot(Field::commandBuffer)});
+                } else {
+                    for (auto *secondaryCmdBuffer : cb_state->linkedCommandBuffers) {
+                        UpdateCmdBufImageLayouts(*secondaryCmdBuffer);
+                    }
+                    UpdateCmdBufImageLayouts(*cb_state);
+                }
                 for (auto *secondaryCmdBuffer : cb_state->linkedCommandBuffers) {
-                    UpdateCmdBufImageLayouts(*secondaryCmdBuffer);
                     RecordQueuedQFOTransfers(*secondaryCmdBuffer);
                 }
-                UpdateCmdBufImageLayouts(*cb_state);
                 RecordQueuedQFOTransfers(*cb_state);
             }
         }
     }
+    if (!async_command_buffers.empty()) {
+        EnqueueSubmitValidation(Get<vvl::Queue>(queue), std::move(async_command_buffers));
+    }
 }
 
 void CoreChecks::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
@@ -454,6 +521,92 @@ void CoreChecks::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount,
     RecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
 }
 
+// Replays what CommandBufferSubmitState::Validate() and the PostCallRecord hooks above skip in async mode, on the
+// submit validation worker. The submitting thread is not waiting on the result, so errors are only reported.
+void CoreChecks::EnqueueSubmitValidation(std::shared_ptr<const vvl::Queue> &&queue_state,
+                                         std::vector<SubmittedCommandBuffer> &&command_buffers) {
+    std::vector<core::CommandBuffer *> used_cbs;
+    for (const auto &command_buffer : command_buffers) {
+        used_cbs.emplace_back(static_cast<core::CommandBuffer *>(command_buffer.cb_state.get()));
+        for (auto *secondary_cmd_buffer : command_buffer.cb_state->linkedCommandBuffers) {
+            used_cbs.emplace_back(static_cast<core::CommandBuffer *>(secondary_cmd_buffer));
+        }
+    }
+
+    const uint64_t ticket = submit_validation_worker.Enqueue([this, queue_state = std::move(queue_state),
+                                                              command_buffers = std::move(command_buffers)]() {
+        std::vector<CmdBufImageLayoutErrors> image_layout_errors;
+        if (parallel_submit_validation) {
+            std::vector<std::shared_ptr<const vvl::CommandBuffer>> cb_states;
+            for (const auto &command_buffer : command_buffers) {
+                cb_states.emplace_back(command_buffer.cb_state);
+            }
+            image_layout_errors = ValidateCmdBufImageLayoutsParallel(cb_states);
+        }
+        // One overlay for the whole vkQueueSubmit call, like CommandBufferSubmitState does
+        GlobalImageLayoutMap overlay_image_layout_map;
+        for (size_t i = 0; i < command_buffers.size(); ++i) {
+            const auto &command_buffer = command_buffers[i];
+            const vvl::CommandBuffer &cb_state = *command_buffer.cb_state;
+            auto guard = cb_state.ReadLock();
+            if (image_layout_errors.empty()) {
+                ValidateCmdBufImageLayouts(command_buffer.loc.Get(), cb_state, overlay_image_layout_map);
+            } else {
+                LogCmdBufImageLayoutErrors(command_buffer.loc.Get(), cb_state, image_layout_errors[i]);
+            }
+            if (queue_state) {
+                ValidateQueueFamilyIndices(command_buffer.loc.Get(), cb_state, *queue_state);
+            }
+        }
+        for (const auto &command_buffer : command_buffers) {
+            const vvl::CommandBuffer &cb_state = *command_buffer.cb_state;
+            auto guard = cb_state.ReadLock();
+            for (auto *secondary_cmd_buffer : cb_state.linkedCommandBuffers) {
+                UpdateCmdBufImageLayouts(*secondary_cmd_buffer);
+            }
+            UpdateCmdBufImageLayouts(cb_state);
+        }
+    });
+
+    // The command buffers are externally synchronized and pending execution, so nothing can wait on them before this
+    for (auto *cb : used_cbs) {
+        cb->submit_validation_ticket.store(ticket);
+    }
+}
+
+void CoreChecks::WaitForAsyncSubmitValidation() const {
+    if (async_submit_validation) {
+        submit_validation_worker.WaitIdle();
+    }
+}
+
+void CoreChecks::WaitForAsyncSubmitValidation(const vvl::CommandBuffer &cb_state) const {
+    if (!async_submit_validation) return;
+    const uint64_t ticket = static_cast<const core::CommandBuffer &>(cb_state).submit_validation_ticket.load();
+    if (ticket != 0) {
+        submit_validation_worker.Wait(ticket);
+    }
+}
+
+void CoreChecks::WaitForAsyncSubmitValidation(VkCommandBuffer command_buffer) const {
+    if (!async_submit_validation) return;
+    // Must not hold the command buffer lock here, the worker takes it too
+    if (auto cb_state = Get<vvl::CommandBuffer>(command_buffer)) {
+        WaitForAsyncSubmitValidation(*cb_state);
+    }
+}
+
+// Report errors of asynchronously validated submissions no later than when the application waits for them
+void CoreChecks::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordQueueWaitIdle(queue, record_obj);
+    WaitForAsyncSubmitValidation();
+}
+
+void CoreChecks::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordDeviceWaitIdle(device, record_obj);
+    WaitForAsyncSubmitValidation();
+}
+
 // Check that the queue family index of 'queue' matches one of the entries in pQueueFamilyIndices
 bool CoreChecks::ValidImageBufferQueue(const vvl::CommandBuffer &cb_state, const VulkanTypedHandle &object,
                                        uint32_t queueFamilyIndex, uint32_t count, const uint32_t *indices,
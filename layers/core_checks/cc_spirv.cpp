@@ -2486,6 +2486,8 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
     }
 }
 
+ValidationCache *CoreChecks::GetShaderAnalysisCache() const { return CastFromHandle<ValidationCache *>(core_validation_cache); }
+
 bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
     bool skip = false;
 
@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <atomic>
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/cmd_buffer_state.h"
 
@@ -33,6 +34,9 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     void RecordWaitEvents(vvl::Func command, uint32_t eventCount, const VkEvent* pEvents,
                           VkPipelineStageFlags2KHR src_stage_mask) override;
+
+    // Ticket of the last CoreChecks::submit_validation_worker task using this command buffer, 0 if there never was one
+    std::atomic<uint64_t> submit_validation_ticket{0};
 };
 
 }  // namespace core
\ No newline at end of file
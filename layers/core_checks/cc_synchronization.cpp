@@ -1687,6 +1687,7 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
                 const auto &image_view_image_state = image_view_state->image_state;
 
                 if (img_barrier_image == image_view_image_state->VkHandle()) {
+                    WaitForAsyncSubmitValidation();
                     auto guard = image_view_image_state->layout_range_map->ReadLock();
 
                     for (const auto &entry : *image_view_image_state->layout_range_map) {
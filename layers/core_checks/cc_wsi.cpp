@@ -789,6 +789,25 @@ bool CoreChecks::ValidateImageAcquireWait(const vvl::SwapchainImage &swapchain_i
     return skip;
 }
 
+bool CoreChecks::ValidatePresentImageLayout(VkQueue queue, const vvl::Image &image_state, const Location &swapchain_loc) const {
+    bool skip = false;
+    std::vector<VkImageLayout> layouts;
+    if (FindLayouts(image_state, layouts)) {
+        for (auto layout : layouts) {
+            if ((layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) &&
+                (!IsExtEnabled(device_extensions.vk_khr_shared_presentable_image) ||
+                 (layout != VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR))) {
+                skip |= LogError("VUID-VkPresentInfoKHR-pImageIndices-01430", queue, swapchain_loc,
+                                 "images passed to present must be in layout "
+                                 "VK_IMAGE_LAYOUT_PRESENT_SRC_KHR or "
+                                 "VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR but is in %s.",
+                                 string_VkImageLayout(layout));
+            }
+        }
+    }
+    return skip;
+}
+
 bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo,
                                                 const ErrorObject &error_obj) const {
     bool skip = false;
@@ -828,19 +847,14 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
             const auto *image_state = swapchain_data->images[pPresentInfo->pImageIndices[i]].image_state;
             ASSERT_AND_CONTINUE(image_state);
 
-            std::vector<VkImageLayout> layouts;
-            if (FindLayouts(*image_state, layouts)) {
-                for (auto layout : layouts) {
-                    if ((layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) &&
-                        (!IsExtEnabled(device_extensions.vk_khr_shared_presentable_image) ||
-                         (layout != VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR))) {
-                        skip |= LogError("VUID-VkPresentInfoKHR-pImageIndices-01430", queue, swapchain_loc,
-                                         "images passed to present must be in layout "
-                                         "VK_IMAGE_LAYOUT_PRESENT_SRC_KHR or "
-                                         "VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR but is in %s.",
-                                         string_VkImageLayout(layout));
-                    }
-                }
+            if (async_submit_validation) {
+                // The layout is set by submissions that may not have been replayed yet, check it after them
+                submit_validation_worker.Enqueue(
+                    [this, queue, image = image_state->shared_from_this(), loc = LocationCapture(swapchain_loc)]() {
+                        ValidatePresentImageLayout(queue, *image, loc.Get());
+                    });
+            } else {
+                skip |= ValidatePresentImageLayout(queue, *image_state, swapchain_loc);
             }
             const auto *display_present_info = vku::FindStructInPNextChain<VkDisplayPresentInfoKHR>(pPresentInfo->pNext);
             if (display_present_info) {
@@ -25,6 +25,7 @@
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "containers/qfo_transfer.h"
+#include "utils/thread_pool.h"
 #include <spirv-tools/libspirv.hpp>
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
@@ -41,7 +42,22 @@ struct SubpassLayout;
 struct DAGNode;
 struct SemaphoreSubmitState;
 
-class CoreChecks : public ValidationStateTracker {
+// A subresource a submitted command buffer expects in another layout than the one it is in
+struct CmdBufImageLayoutError {
+    std::shared_ptr<const vvl::Image> image_state;
+    VkImageSubresource subresource;
+    VkImageLayout initial_layout;
+    VkImageLayout image_layout;
+};
+using CmdBufImageLayoutErrors = std::vector<CmdBufImageLayoutError>;
+
+// A command buffer passed to vkQueueSubmit*, kept around for validation done after the call returns
+struct SubmittedCommandBuffer {
+    std::shared_ptr<vvl::CommandBuffer> cb_state;
+    LocationCapture loc;
+};
+
+class CoreChecks final : public ValidationStateTracker {
   public:
     using StateTracker = ValidationStateTracker;
     using Func = vvl::Func;
@@ -57,6 +73,8 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // The file at validation_cache_path was loaded and matches the cache, so new entries can be appended to it
+    bool validation_cache_file_appendable = false;
 
     // The options are set from extensions/features only, so only need ot create once.
     // This also is needed for shader caching (You can have the same SPIR-V, but different Vulkan features making it legal/illegal
@@ -64,6 +82,16 @@ class CoreChecks : public ValidationStateTracker {
     spvtools::ValidatorOptions spirv_val_options;
     uint32_t spirv_val_option_hash;
 
+    // When set, image layout and queue family validation of submitted command buffers (and the image layout updates that
+    // follow it) is done on submit_validation_worker instead of in vkQueueSubmit*. Any code reading the global image layouts
+    // must call WaitForAsyncSubmitValidation() first.
+    bool async_submit_validation = false;
+    // A single thread, so submissions are replayed in the order they were made
+    mutable vvl::ThreadPool submit_validation_worker{1};
+    // When set, the image layouts of the command buffers of a submission are validated on submit_validation_pool
+    bool parallel_submit_validation = false;
+    mutable vvl::ThreadPool submit_validation_pool{0};
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() const override;
@@ -683,6 +711,7 @@ class CoreChecks : public ValidationStateTracker {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    ValidationCache* GetShaderAnalysisCache() const override;
     bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
                                 const Location& loc) const;
     bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
@@ -1002,8 +1031,21 @@ class CoreChecks : public ValidationStateTracker {
 
     bool ValidateCmdBufImageLayouts(const Location& loc, const vvl::CommandBuffer& cb_state,
                                     GlobalImageLayoutMap& overlayLayoutMap) const;
+    std::vector<CmdBufImageLayoutErrors> ValidateCmdBufImageLayoutsParallel(
+        const std::vector<std::shared_ptr<const vvl::CommandBuffer>>& cb_states) const;
+    bool LogCmdBufImageLayoutError(const Location& loc, const vvl::CommandBuffer& cb_state, const vvl::Image& image_state,
+                                   const VkImageSubresource& subresource, VkImageLayout initial_layout,
+                                   VkImageLayout image_layout) const;
+    bool LogCmdBufImageLayoutErrors(const Location& loc, const vvl::CommandBuffer& cb_state,
+                                    const CmdBufImageLayoutErrors& errors) const;
 
     void UpdateCmdBufImageLayouts(const vvl::CommandBuffer& cb_state);
+    void EnqueueSubmitValidation(std::shared_ptr<const vvl::Queue>&& queue_state,
+                                 std::vector<SubmittedCommandBuffer>&& command_buffers);
+    void WaitForAsyncSubmitValidation() const;
+    // Only waits for the submissions using the command buffer, so its state can be reset
+    void WaitForAsyncSubmitValidation(const vvl::CommandBuffer& cb_state) const;
+    void WaitForAsyncSubmitValidation(VkCommandBuffer command_buffer) const;
 
     bool VerifyBoundMemoryIsValid(const vvl::DeviceMemory* mem_state, const LogObjectList& objlist,
                                   const VulkanTypedHandle& typed_handle, const Location& loc, const char* vuid) const;
@@ -1330,6 +1372,8 @@ class CoreChecks : public ValidationStateTracker {
                                        const RecordObject& record_obj) override;
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
                                     const RecordObject& record_obj) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject& record_obj) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject& record_obj) override;
     bool IgnoreAllocationSize(const VkMemoryAllocateInfo& allocate_info) const;
     bool HasExternalMemoryImportSupport(const vvl::Buffer& buffer, VkExternalMemoryHandleTypeFlagBits handle_type) const;
     bool HasExternalMemoryImportSupport(const vvl::Image& image, VkExternalMemoryHandleTypeFlagBits handle_type) const;
@@ -1904,6 +1948,7 @@ class CoreChecks : public ValidationStateTracker {
                                            const ErrorObject& error_obj) const override;
     void PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator,
                                           const RecordObject& record_obj) override;
+    bool ValidatePresentImageLayout(VkQueue queue, const vvl::Image& image_state, const Location& swapchain_loc) const;
     bool PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo,
                                         const ErrorObject& error_obj) const override;
     bool ValidateImageAcquireWait(const vvl::SwapchainImage& swapchain_image, uint32_t image_index,
@@ -27,6 +27,7 @@ struct GpuAVSettings {
     bool validate_ray_query = true;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    bool parallel_instrumentation = false;
 
     bool buffers_validation_enabled = true;
     bool validate_indirect_draws_buffers = true;
@@ -16,7 +16,7 @@
  */
 
 #include <cmath>
-#include <fstream>
+#include <sstream>
 #include "utils/hash_util.h"
 #include "gpu/core/gpuav.h"
 #include "gpu/cmd_validation/gpuav_draw.h"
@@ -96,10 +96,10 @@ void Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createIn
         if (gpuav_settings.select_instrumented_shaders && !IsSelectiveInstrumentationEnabled(pCreateInfos[i].pNext)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
             const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (instrumented_shaders_cache_.IsSpirvCached(i, chassis_state.unique_shader_ids[i], chassis_state)) {
+            chassis_state.unique_shader_ids[i] = shader_hash;
+            if (instrumented_shaders_cache_.IsSpirvCached(i, shader_hash, chassis_state)) {
                 continue;
             }
-            chassis_state.unique_shader_ids[i] = shader_hash;
         } else {
             chassis_state.unique_shader_ids[i] = unique_shader_module_id_++;
         }
@@ -123,22 +123,9 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     shared_resources_manager.Clear();
 
-    if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders_cache_.IsEmpty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path_, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings);
-            file_stream.write(reinterpret_cast<const char *>(&shader_cache_hash), sizeof(shader_cache_hash));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders_cache_.spirv_shaders_.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders_cache_.spirv_shaders_) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                const size_t spirv_dwords_count = record.second.size();
-                file_stream.write(reinterpret_cast<const char *>(&spirv_dwords_count), sizeof(uint32_t));
-                file_stream.write(reinterpret_cast<const char *>(record.second.data()), spirv_dwords_count * sizeof(uint32_t));
-            }
-            file_stream.close();
-        }
+    if (gpuav_settings.cache_instrumented_shaders) {
+        const ShaderCacheHash shader_cache_hash(gpuav_settings);
+        instrumented_shaders_cache_.SaveFile(instrumented_shader_cache_path_, &shader_cache_hash, sizeof(shader_cache_hash));
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
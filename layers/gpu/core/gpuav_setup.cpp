@@ -16,7 +16,6 @@
  */
 
 #include <cmath>
-#include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
 #include <unistd.h>
 #endif
@@ -189,27 +188,8 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
 #endif
         instrumented_shader_cache_path_ += ".bin";
 
-        std::ifstream file_stream(instrumented_shader_cache_path_, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings);
-            char inst_shader_hash[sizeof(shader_cache_hash)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (std::memcmp(inst_shader_hash, reinterpret_cast<char *>(&shader_cache_hash), sizeof(shader_cache_hash)) == 0) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t spirv_dwords_count;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&spirv_dwords_count), sizeof(uint32_t));
-                    shader_code.resize(spirv_dwords_count);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * spirv_dwords_count);
-                    instrumented_shaders_cache_.Add(hash, std::move(shader_code));
-                }
-            }
-            file_stream.close();
-        }
+        const ShaderCacheHash shader_cache_hash(gpuav_settings);
+        instrumented_shaders_cache_.LoadFile(instrumented_shader_cache_path_, &shader_cache_hash, sizeof(shader_cache_hash));
     }
 
     // Create command indices buffer
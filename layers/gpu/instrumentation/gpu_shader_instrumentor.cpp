@@ -24,7 +24,9 @@
 #include "spirv-tools/optimizer.hpp"
 #include "utils/vk_layer_utils.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <regex>
 #include <fstream>
 
@@ -138,18 +140,17 @@ static VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical
 
 void SpirvCache::Add(uint32_t hash, std::vector<uint32_t> spirv) { spirv_shaders_.emplace(hash, std::move(spirv)); }
 
-std::vector<uint32_t> *SpirvCache::Get(uint32_t spirv_hash) {
+vvl::span<const uint32_t> SpirvCache::Get(uint32_t spirv_hash) const {
     auto it = spirv_shaders_.find(spirv_hash);
     if (it != spirv_shaders_.end()) {
-        return &it->second;
+        return vvl::span<const uint32_t>(it->second.data(), it->second.size());
     }
-    return nullptr;
+    return file_view_.Find(spirv_hash);
 }
 
 bool SpirvCache::IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const {
-    auto it = spirv_shaders_.find(spirv_hash);
-    if (it != spirv_shaders_.end()) {
-        const std::vector<uint32_t> &spirv = it->second;
+    const vvl::span<const uint32_t> spirv = Get(spirv_hash);
+    if (!spirv.empty()) {
         chassis_state.instrumented_create_info[index].codeSize = spirv.size() * sizeof(uint32_t);
         chassis_state.instrumented_create_info[index].pCode = spirv.data();
         return true;
@@ -157,6 +158,56 @@ bool SpirvCache::IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::Sha
     return false;
 }
 
+void SpirvCache::LoadFile(const std::string &path, const void *file_key, size_t file_key_size) {
+    file_ = vvl::MappedFile::Open(path.c_str());
+    if (file_ && !file_view_.Parse(*file_, file_key, file_key_size)) {
+        file_.reset();
+        file_view_ = {};
+    }
+}
+
+bool SpirvCache::SaveFile(const std::string &path, const void *file_key, size_t file_key_size) {
+    if (spirv_shaders_.empty()) {
+        file_view_ = {};
+        file_.reset();
+        return true;
+    }
+
+    // Another device, possibly in another process, may have updated the file since it was loaded, keep its shaders too
+    vvl::SpirvCacheFileView current_view;
+    std::unique_ptr<vvl::MappedFile> current_file = vvl::MappedFile::Open(path.c_str());
+    if (current_file && !current_view.Parse(*current_file, file_key, file_key_size)) {
+        current_file.reset();
+    }
+
+    std::vector<std::pair<uint32_t, vvl::span<const uint32_t>>> shaders;
+    shaders.reserve(spirv_shaders_.size() + file_view_.Entries().size() + current_view.Entries().size());
+    for (const auto &[hash, spirv] : spirv_shaders_) {
+        shaders.emplace_back(hash, vvl::span<const uint32_t>(spirv.data(), spirv.size()));
+    }
+    for (const vvl::SpirvCacheFileView *view : {&file_view_, &current_view}) {
+        for (const vvl::SpirvCacheFileView::Entry &entry : view->Entries()) {
+            const vvl::span<const uint32_t> spirv = view->Spirv(entry);
+            if (!spirv.empty()) {
+                shaders.emplace_back(entry.spirv_hash, spirv);
+            }
+        }
+    }
+    // Stable, so that when a shader is found more than once, the first (most recent) one is kept
+    std::stable_sort(shaders.begin(), shaders.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    shaders.erase(std::unique(shaders.begin(), shaders.end(), [](const auto &a, const auto &b) { return a.first == b.first; }),
+                  shaders.end());
+
+    std::vector<uint32_t> file_data;
+    vvl::SpirvCacheFileView::Write(file_key, file_key_size, shaders, file_data);
+
+    // Everything was copied out of the mappings, which must be gone before the file is replaced on some platforms
+    file_view_ = {};
+    file_.reset();
+    current_file.reset();
+    return vvl::WriteFileAtomic(path.c_str(), file_data.data(), file_data.size() * sizeof(uint32_t));
+}
+
 ReadLockGuard GpuShaderInstrumentor::ReadLock() const {
     if (global_settings.fine_grained_locking) {
         return ReadLockGuard(validation_object_mutex, std::defer_lock);
@@ -552,6 +603,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
                                                                  const RecordObject &record_obj, PipelineStates &pipeline_states,
                                                                  chassis::CreateGraphicsPipelines &chassis_state) {
     std::vector<vku::safe_VkGraphicsPipelineCreateInfo> new_pipeline_create_infos;
+    new_pipeline_create_infos.reserve(count);  // stages point into it
+    std::vector<PipelineStageInstrumentation<vku::safe_VkGraphicsPipelineCreateInfo>> stages;
     chassis_state.shader_instrumentations_metadata.resize(count);
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -560,11 +613,11 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
-
         new_pipeline_create_infos.emplace_back(std::move(new_pipeline_ci));
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_create_infos.back(),
+                                                           create_info_loc, shader_instrumentation_metadata, stages);
     }
+    InstrumentPipelineStages(pAllocator, stages);
 
     chassis_state.modified_create_infos = new_pipeline_create_infos;
     chassis_state.pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(chassis_state.modified_create_infos.data());
@@ -576,6 +629,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
                                                                 const RecordObject &record_obj, PipelineStates &pipeline_states,
                                                                 chassis::CreateComputePipelines &chassis_state) {
     std::vector<vku::safe_VkComputePipelineCreateInfo> new_pipeline_create_infos;
+    new_pipeline_create_infos.reserve(count);  // stages point into it
+    std::vector<PipelineStageInstrumentation<vku::safe_VkComputePipelineCreateInfo>> stages;
     chassis_state.shader_instrumentations_metadata.resize(count);
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -584,11 +639,11 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
-
         new_pipeline_create_infos.emplace_back(std::move(new_pipeline_ci));
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_create_infos.back(),
+                                                           create_info_loc, shader_instrumentation_metadata, stages);
     }
+    InstrumentPipelineStages(pAllocator, stages);
 
     chassis_state.modified_create_infos = new_pipeline_create_infos;
     chassis_state.pCreateInfos = reinterpret_cast<VkComputePipelineCreateInfo *>(chassis_state.modified_create_infos.data());
@@ -601,6 +656,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesNV(VkDevice de
                                                                      PipelineStates &pipeline_states,
                                                                      chassis::CreateRayTracingPipelinesNV &chassis_state) {
     std::vector<vku::safe_VkRayTracingPipelineCreateInfoCommon> new_pipeline_create_infos;
+    new_pipeline_create_infos.reserve(count);  // stages point into it
+    std::vector<PipelineStageInstrumentation<vku::safe_VkRayTracingPipelineCreateInfoCommon>> stages;
     chassis_state.shader_instrumentations_metadata.resize(count);
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -609,11 +666,11 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesNV(VkDevice de
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
-
         new_pipeline_create_infos.emplace_back(std::move(new_pipeline_ci));
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_create_infos.back(),
+                                                           create_info_loc, shader_instrumentation_metadata, stages);
     }
+    InstrumentPipelineStages(pAllocator, stages);
 
     chassis_state.modified_create_infos = new_pipeline_create_infos;
     chassis_state.pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoNV *>(chassis_state.modified_create_infos.data());
@@ -627,6 +684,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
                                                          pPipelines, record_obj, pipeline_states, chassis_state);
 
     std::vector<vku::safe_VkRayTracingPipelineCreateInfoKHR> new_pipeline_create_infos;
+    new_pipeline_create_infos.reserve(count);  // stages point into it
+    std::vector<PipelineStageInstrumentation<vku::safe_VkRayTracingPipelineCreateInfoKHR>> stages;
     chassis_state.shader_instrumentations_metadata.resize(count);
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -635,11 +694,11 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
-
         new_pipeline_create_infos.emplace_back(std::move(new_pipeline_ci));
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_create_infos.back(),
+                                                           create_info_loc, shader_instrumentation_metadata, stages);
     }
+    InstrumentPipelineStages(pAllocator, stages);
 
     chassis_state.modified_create_infos = new_pipeline_create_infos;
     chassis_state.pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoKHR *>(chassis_state.modified_create_infos.data());
@@ -868,7 +927,8 @@ bool GpuShaderInstrumentor::IsSelectiveInstrumentationEnabled(const void *pNext)
 template <typename SafeCreateInfo>
 void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
     const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &new_pipeline_ci, const Location &loc,
-    chassis::ShaderInstrumentationMetadata &shader_instrumentation_metadata) {
+    chassis::ShaderInstrumentationMetadata &shader_instrumentation_metadata,
+    std::vector<PipelineStageInstrumentation<SafeCreateInfo>> &out_stages) {
     if (pipeline_state.stage_states.empty()) return;  // will hit with GPL without shaders in them
 
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
@@ -890,7 +950,7 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
 
     for (uint32_t i = 0; i < static_cast<uint32_t>(pipeline_state.stage_states.size()); ++i) {
         const auto &stage_state = pipeline_state.stage_states[i];
-        auto module_state = std::const_pointer_cast<vvl::ShaderModule>(stage_state.module_state);
+        auto module_state = stage_state.module_state;
         ASSERT_AND_CONTINUE(module_state);
 
         const VkShaderStageFlagBits stage = stage_state.GetStage();
@@ -914,50 +974,84 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
             }
         }
 
-        uint32_t unique_shader_id = 0;
-        bool cached = false;
-        bool pass = false;
-        std::vector<uint32_t> instrumented_spirv;
+        auto &stage_instrumentation = out_stages.emplace_back(PipelineStageInstrumentation<SafeCreateInfo>{
+            &pipeline_state, &new_pipeline_ci, &shader_instrumentation_metadata, loc, i, module_state, sm_ci, 0, false, false,
+            {}, {}});
         if (gpuav_settings.cache_instrumented_shaders) {
-            unique_shader_id = hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-            if (const auto spirv = instrumented_shaders_cache_.Get(unique_shader_id)) {
-                instrumented_spirv = *spirv;
-                cached = true;
+            stage_instrumentation.unique_shader_id =
+                hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
+            const vvl::span<const uint32_t> spirv = instrumented_shaders_cache_.Get(stage_instrumentation.unique_shader_id);
+            if (!spirv.empty()) {
+                stage_instrumentation.instrumented_spirv.assign(spirv.begin(), spirv.end());
+                stage_instrumentation.cached = true;
             }
         } else {
-            unique_shader_id = unique_shader_module_id_++;
+            stage_instrumentation.unique_shader_id = unique_shader_module_id_++;
+        }
+    }
+}
+
+template <typename SafeCreateInfo>
+void GpuShaderInstrumentor::InstrumentPipelineStages(const VkAllocationCallbacks *pAllocator,
+                                                     std::vector<PipelineStageInstrumentation<SafeCreateInfo>> &stages) {
+    auto instrument = [this, &stages](uint32_t index) {
+        auto &stage = stages[index];
+        if (stage.cached) return;
+        stage.pass = InstrumentShader(stage.module_state->spirv->words_, stage.unique_shader_id, stage.loc,
+                                      stage.instrumented_spirv, stage.internal_error);
+    };
+    const uint32_t stage_count = static_cast<uint32_t>(stages.size());
+    if (gpuav_settings.parallel_instrumentation && stage_count > 1) {
+        instrumentation_pool_.ParallelFor(stage_count, instrument);
+    } else {
+        for (uint32_t i = 0; i < stage_count; ++i) {
+            instrument(i);
         }
-        if (!cached) {
-            pass = InstrumentShader(module_state->spirv->words_, unique_shader_id, loc, instrumented_spirv);
+    }
+
+    for (auto &stage_instrumentation : stages) {
+        const Location &loc = stage_instrumentation.loc;
+        if (!stage_instrumentation.internal_error.empty()) {
+            InternalError(device, loc, stage_instrumentation.internal_error.c_str());
         }
-        if (cached || pass) {
-            shader_instrumentation_metadata.spirv_unique_id_map[i] = unique_shader_id;
-            if (module_state->VkHandle() != VK_NULL_HANDLE) {
-                // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
-                // shader
-                VkShaderModule instrumented_shader_module;
-                VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
-                create_info.pCode = instrumented_spirv.data();
-                create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-                VkResult result = DispatchCreateShaderModule(device, &create_info, pAllocator, &instrumented_shader_module);
-                if (result == VK_SUCCESS) {
-                    SetShaderModule(new_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module, i);
-                    pipeline_state.instrumented_shader_module.emplace_back(instrumented_shader_module);
-                } else {
-                    InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
-                }
-            } else if (sm_ci) {
-                // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
-                shader_instrumentation_metadata.passed_in_shader_stage_ci = true;
-                // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL)
-                sm_ci->SetCode(instrumented_spirv);
+        if (!stage_instrumentation.cached && !stage_instrumentation.pass) {
+            continue;
+        }
+
+        const uint32_t i = stage_instrumentation.stage_index;
+        vvl::Pipeline &pipeline_state = *stage_instrumentation.pipeline_state;
+        const auto &stage_state = pipeline_state.stage_states[i];
+        const auto &module_state = stage_instrumentation.module_state;
+        auto &instrumented_spirv = stage_instrumentation.instrumented_spirv;
+        auto &shader_instrumentation_metadata = *stage_instrumentation.shader_instrumentation_metadata;
+
+        shader_instrumentation_metadata.spirv_unique_id_map[i] = stage_instrumentation.unique_shader_id;
+        if (module_state->VkHandle() != VK_NULL_HANDLE) {
+            // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
+            // shader
+            VkShaderModule instrumented_shader_module;
+            VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
+            create_info.pCode = instrumented_spirv.data();
+            create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
+            VkResult result = DispatchCreateShaderModule(device, &create_info, pAllocator, &instrumented_shader_module);
+            if (result == VK_SUCCESS) {
+                SetShaderModule(*stage_instrumentation.new_pipeline_ci, *stage_state.pipeline_create_info,
+                                instrumented_shader_module, i);
+                pipeline_state.instrumented_shader_module.emplace_back(instrumented_shader_module);
             } else {
-                assert(false);
+                InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
             }
+        } else if (stage_instrumentation.sm_ci) {
+            // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
+            shader_instrumentation_metadata.passed_in_shader_stage_ci = true;
+            // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL)
+            stage_instrumentation.sm_ci->SetCode(instrumented_spirv);
+        } else {
+            assert(false);
+        }
 
-            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                instrumented_shaders_cache_.Add(unique_shader_id, instrumented_spirv);
-            }
+        if (gpuav_settings.cache_instrumented_shaders && !stage_instrumentation.cached) {
+            instrumented_shaders_cache_.Add(stage_instrumentation.unique_shader_id, instrumented_spirv);
         }
     }
 }
@@ -1077,9 +1171,20 @@ static bool GpuValidateShader(const std::vector<uint32_t> &input, bool SetRelaxB
     return (result == SPV_SUCCESS);
 }
 
-// Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
 bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
                                              const Location &loc, std::vector<uint32_t> &out_instrumented_spirv) {
+    std::string internal_error;
+    const bool pass = InstrumentShader(input_spirv, unique_shader_id, loc, out_instrumented_spirv, internal_error);
+    if (!internal_error.empty()) {
+        InternalError(device, loc, internal_error.c_str());
+    }
+    return pass;
+}
+
+// Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
+                                             const Location &loc, std::vector<uint32_t> &out_instrumented_spirv,
+                                             std::string &out_internal_error) {
     if (input_spirv[0] != spv::MagicNumber) return false;
 
     if (gpuav_settings.debug_dump_instrumented_shaders) {
@@ -1152,7 +1257,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
             std::ostringstream strm;
             strm << "Instrumented shader (id " << unique_shader_id << ") is invalid, spirv-val error:\n"
                  << instrumented_error << " Proceeding with non instrumented shader.";
-            InternalError(device, loc, strm.str().c_str());
+            out_internal_error = strm.str();
             return false;
         }
     }
@@ -1183,8 +1288,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
         // Call CreateAggressiveDCEPass with preserve_interface == true
         dce_pass.RegisterPass(CreateAggressiveDCEPass(true));
         if (!dce_pass.Run(out_instrumented_spirv.data(), out_instrumented_spirv.size(), &out_instrumented_spirv, opt_options)) {
-            InternalError(device, loc,
-                          "Failure to run spirv-opt DCE on instrumented shader. Proceeding with non-instrumented shader.");
+            out_internal_error = "Failure to run spirv-opt DCE on instrumented shader. Proceeding with non-instrumented shader.";
             return false;
         }
 
@@ -21,14 +21,15 @@
 #include "gpu/core/gpu_state_tracker.h"
 #include "gpu/resources/gpu_resources.h"
 #include "gpu/spirv/instruction.h"
+#include "utils/mapped_file.h"
+#include "utils/spirv_cache_file.h"
+#include "utils/thread_pool.h"
 #include "vma/vma.h"
 
+#include <memory>
+#include <string>
 #include <vector>
 
-namespace gpuav {
-class Validator;
-}
-
 namespace chassis {
 struct ShaderInstrumentationMetadata;
 }
@@ -47,16 +48,28 @@ static const VkShaderModule kPipelineStageInfoHandle = CastFromUint64<VkShaderMo
 // We set a reasonable max because we have to pad the pipeline layout with dummy descriptor set layouts.
 static const uint32_t kMaxAdjustedBoundDescriptorSet = 33;
 
+// Instrumented SPIR-V, keyed by the hash of the original SPIR-V.
+// It can be backed by a file from a previous run, which is mapped and used in place: the file is never read as a whole, and
+// only the pages of the shaders actually looked up are ever read from disk. Shader objects use the SPIR-V found in it
+// directly, pipelines still copy it into the std::vector each instrumented stage is built from.
 class SpirvCache {
   public:
     void Add(uint32_t hash, std::vector<uint32_t> spirv);
-    std::vector<uint32_t> *Get(uint32_t spirv_hash);
-    bool IsEmpty() { return spirv_shaders_.empty(); }
+    // Returns an empty span if the shader is not cached. The SPIR-V stays valid as long as the cache.
+    vvl::span<const uint32_t> Get(uint32_t spirv_hash) const;
     bool IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const;
 
+    // file_key identifies everything, other than the original SPIR-V, that the instrumented SPIR-V depends on.
+    // Files written with a different key are ignored.
+    void LoadFile(const std::string &path, const void *file_key, size_t file_key_size);
+    // Writes all cached shaders to path, unless none were added since LoadFile().
+    // Releases the loaded file, so the cache must not be used anymore after this.
+    bool SaveFile(const std::string &path, const void *file_key, size_t file_key_size);
+
   private:
-    friend class gpuav::Validator;
     vvl::unordered_map<uint32_t, std::vector<uint32_t>> spirv_shaders_{};
+    std::unique_ptr<vvl::MappedFile> file_;
+    vvl::SpirvCacheFileView file_view_;
 };
 
 struct GpuAssistedShaderTracker {
@@ -189,10 +202,35 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
                                             VkDeviceQueueCreateFlags flags,
                                             const VkQueueFamilyProperties &queueFamilyProperties) override;
 
+    // A shader stage of a pipeline being created that needs to be instrumented. They are gathered for all the pipelines of a
+    // vkCreate*Pipelines call first, so the instrumentation itself can be done in parallel.
+    template <typename SafeCreateInfo>
+    struct PipelineStageInstrumentation {
+        vvl::Pipeline *pipeline_state;
+        SafeCreateInfo *new_pipeline_ci;
+        chassis::ShaderInstrumentationMetadata *shader_instrumentation_metadata;
+        Location loc;
+        uint32_t stage_index;
+        std::shared_ptr<const vvl::ShaderModule> module_state;
+        // Set if the SPIR-V is inlined in the pipeline
+        vku::safe_VkShaderModuleCreateInfo *sm_ci;
+        uint32_t unique_shader_id;
+        bool cached;
+        bool pass;
+        std::vector<uint32_t> instrumented_spirv;
+        std::string internal_error;
+    };
+
     template <typename SafeCreateInfo>
     void PreCallRecordPipelineCreationShaderInstrumentation(
         const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &new_pipeline_ci,
-        const Location &loc, chassis::ShaderInstrumentationMetadata &shader_instrumentation_metadata);
+        const Location &loc, chassis::ShaderInstrumentationMetadata &shader_instrumentation_metadata,
+        std::vector<PipelineStageInstrumentation<SafeCreateInfo>> &out_stages);
+    // Instruments the stages gathered by PreCallRecordPipelineCreationShaderInstrumentation() and puts the instrumented shaders
+    // in their pipeline create infos
+    template <typename SafeCreateInfo>
+    void InstrumentPipelineStages(const VkAllocationCallbacks *pAllocator,
+                                  std::vector<PipelineStageInstrumentation<SafeCreateInfo>> &stages);
     void PostCallRecordPipelineCreationShaderInstrumentation(
         vvl::Pipeline &pipeline_state, chassis::ShaderInstrumentationMetadata &shader_instrumentation_metadata);
     void PostCallRecordPipelineCreationsRT(VkResult result, VkDeferredOperationKHR deferredOperation,
@@ -203,6 +241,10 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // Returns if shader was instrumented successfully or not
     bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id, const Location &loc,
                           std::vector<uint32_t> &out_instrumented_spirv);
+    // Same as InstrumentShader(), but internal errors are returned instead of reported, as reporting them disables the layer
+    // object, which can only be done from the thread making the API call. Safe to call on multiple threads at once.
+    bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id, const Location &loc,
+                          std::vector<uint32_t> &out_instrumented_spirv, std::string &out_internal_error);
 
     VkDescriptorSetLayout GetDebugDescriptorSetLayout() { return debug_desc_layout_; }
 
@@ -242,6 +284,9 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
 
     // Pass select_instrumented_shaders from vkCreateShaderModule to CreatePipeline time
     vvl::unordered_set<VkShaderModule> selected_instrumented_shaders;
+
+    // Used with gpuav_settings.parallel_instrumentation
+    vvl::ThreadPool instrumentation_pool_{0};
 };
 
 }  // namespace gpu
@@ -23,15 +23,16 @@
 namespace gpu {
 namespace spirv {
 
-static LinkInfo link_info = {instrumentation_bindless_descriptor_comp, instrumentation_bindless_descriptor_comp_size,
-                             LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
+static const LinkInfo link_info = {instrumentation_bindless_descriptor_comp, instrumentation_bindless_descriptor_comp_size,
+                                   LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BindlessDescriptorPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        LinkInfo module_link_info = link_info;
+        module_link_info.function_id = link_function_id;
+        module_.link_info_.push_back(module_link_info);
     }
     return link_function_id;
 }
@@ -654,6 +654,8 @@ void Module::InternalWarning(const char* tag, const char* message) {
 
 void Module::InternalError(const char* tag, const char* message) {
     if (debug_report_) {
+        // Modules can be instrumented on multiple threads
+        std::unique_lock<std::mutex> lock(debug_report_->debug_output_mutex);
         debug_report_->DebugLogMsg(kErrorBit, {}, message, tag);
     } else {
         std::cerr << "[" << tag << "] " << message << '\n';
@@ -23,15 +23,16 @@
 namespace gpu {
 namespace spirv {
 
-static LinkInfo link_info = {instrumentation_ray_query_comp, instrumentation_ray_query_comp_size, LinkFunctions::inst_ray_query, 0,
-                             "inst_ray_query"};
+static const LinkInfo link_info = {instrumentation_ray_query_comp, instrumentation_ray_query_comp_size,
+                                   LinkFunctions::inst_ray_query, 0, "inst_ray_query"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t RayQueryPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        LinkInfo module_link_info = link_info;
+        module_link_info.function_id = link_function_id;
+        module_.link_info_.push_back(module_link_info);
     }
     return link_function_id;
 }
@@ -160,6 +160,10 @@ const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 // GloablSettings
 // ---
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_ASYNC_SUBMIT_VALIDATION = "async_submit_validation";
+const char *VK_LAYER_PARALLEL_SUBMIT_VALIDATION = "parallel_submit_validation";
+const char *VK_LAYER_PARALLEL_SHADER_PARSING = "parallel_shader_parsing";
+const char *VK_LAYER_THREAD_SAFETY_SAMPLE_RATE = "thread_safety_sample_rate";
 // Debug settings used for internal development
 const char *VK_LAYER_DEBUG_DISABLE_SPIRV_VAL = "debug_disable_spirv_val";
 
@@ -179,6 +183,7 @@ const char *VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESSES = "gpuav_max_buffer_devic
 const char *VK_LAYER_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION = "gpuav_parallel_instrumentation";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -199,6 +204,11 @@ const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print
 // ---
 const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION = "syncval_submit_time_validation";
 const char *VK_LAYER_SYNCVAL_SHADER_ACCESSES_HEURISTIC = "syncval_shader_accesses_heuristic";
+const char *VK_LAYER_SYNCVAL_PARALLEL_HAZARD_DETECTION = "syncval_parallel_hazard_detection";
+const char *VK_LAYER_SYNCVAL_UNLOCKED_RECORDING = "syncval_unlocked_recording";
+const char *VK_LAYER_SYNCVAL_STATS = "syncval_stats";
+const char *VK_LAYER_SYNCVAL_STATS_FILE = "syncval_stats_file";
+const char *VK_LAYER_SYNCVAL_STATS_INTERVAL = "syncval_stats_interval";
 
 // Message Formatting
 // ---
@@ -514,6 +524,25 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, global_settings.fine_grained_locking);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_SUBMIT_VALIDATION, global_settings.async_submit_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION, global_settings.parallel_submit_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_SHADER_PARSING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_SHADER_PARSING, global_settings.parallel_shader_parsing);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_SAFETY_SAMPLE_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_SAFETY_SAMPLE_RATE, global_settings.thread_safety_sample_rate);
+        if (global_settings.thread_safety_sample_rate == 0) {
+            global_settings.thread_safety_sample_rate = 1;
+        }
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL, global_settings.debug_disable_spirv_val);
     }
@@ -603,6 +632,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                    DEPRECATED_GPUAV_SELECT_INSTRUMENTED_SHADERS, VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS);
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION,
+                                    gpuav_settings.parallel_instrumentation);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -696,6 +730,27 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 syncval_settings.shader_accesses_heuristic);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_HAZARD_DETECTION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_HAZARD_DETECTION,
+                                syncval_settings.parallel_hazard_detection);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_UNLOCKED_RECORDING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_UNLOCKED_RECORDING, syncval_settings.unlocked_recording);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS, syncval_settings.stats);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS_FILE, syncval_settings.stats_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS_INTERVAL, syncval_settings.stats_interval);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME,
                                 settings_data->message_format_settings->display_application_name);
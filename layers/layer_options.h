@@ -81,6 +81,12 @@ using CHECK_ENABLED = std::array<bool, kMaxEnableFlags>;
 // General settings to be used by all parts of the Validation Layers
 struct GlobalSettings {
     bool fine_grained_locking = true;
+    // Only takes effect with fine_grained_locking
+    bool async_submit_validation = false;
+    bool parallel_submit_validation = false;
+    bool parallel_shader_parsing = false;
+    // Thread Safety tracks the object uses of 1 in this many calls, all threads sampling the same calls (1: all of them)
+    uint32_t thread_safety_sample_rate = 1;
 
     bool debug_disable_spirv_val = false;
 };
@@ -31,14 +31,91 @@ struct ObjTrackState {
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool and VkCommandPool)
 };
 
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+// Dense index of the tracked objects with wrapped handles, so that checking that an object is tracked is an index and a compare
+// instead of a hashed, locked probe of object_map.
+//
+// Wrapped handles are unique_id_mapping keys, so each live one has a slot of its own: the entry at that slot index holds the
+// generation and type of the object tracked there. A stale handle of a destroyed object has an older generation than any
+// object reusing its slot, so it is never mistaken for it. Entries are only added next to object_map insertions and never
+// relied on for misses, which are looked up in object_map as before.
+class WrappedObjectIndex {
+  public:
+    WrappedObjectIndex() : segments_(new std::atomic<Entry *>[kMaxSegments]) {
+        for (uint32_t i = 0; i < kMaxSegments; ++i) {
+            segments_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~WrappedObjectIndex() {
+        for (uint32_t i = 0; i < kMaxSegments; ++i) {
+            delete[] segments_[i].load(std::memory_order_relaxed);
+        }
+    }
+    WrappedObjectIndex(const WrappedObjectIndex &) = delete;
+    WrappedObjectIndex &operator=(const WrappedObjectIndex &) = delete;
+
+    void Insert(uint64_t handle, VulkanObjectType object_type) {
+        if (!IsIndexed(object_type) || !unique_id_mapping.contains(handle)) return;
+        const uint32_t index = UniqueIdMapping::SlotIndex(handle);
+        std::atomic<Entry *> &segment_entry = segments_[index / kSegmentSize];
+        Entry *segment = segment_entry.load(std::memory_order_acquire);
+        if (!segment) {
+            auto new_segment = std::make_unique<Entry[]>(kSegmentSize);
+            if (segment_entry.compare_exchange_strong(segment, new_segment.get(), std::memory_order_acq_rel)) {
+                segment = new_segment.release();
+            }
+        }
+        segment[index % kSegmentSize].store(MakeEntry(handle, object_type), std::memory_order_release);
+    }
+
+    void Erase(uint64_t handle, VulkanObjectType object_type) {
+        if (!IsIndexed(object_type)) return;
+        if (Entry *entry = Find(handle)) {
+            uint64_t expected = MakeEntry(handle, object_type);
+            entry->compare_exchange_strong(expected, 0, std::memory_order_acq_rel);
+        }
+    }
+
+    bool Contains(uint64_t handle, VulkanObjectType object_type) const {
+        const Entry *entry = Find(handle);
+        return entry && entry->load(std::memory_order_acquire) == MakeEntry(handle, object_type);
+    }
+
+  private:
+    // Generation in the high 32 bits, object type in the low 32 bits. 0 for unused entries, since generations start at 1.
+    using Entry = std::atomic<uint64_t>;
+    static constexpr uint32_t kSegmentSize = UniqueIdMapping::kSegmentSize;
+    static constexpr uint32_t kMaxSegments = UniqueIdMapping::kMaxSegments;
+
+    // Dispatchable handles are not wrapped, and could alias a wrapped handle's key
+    static bool IsIndexed(VulkanObjectType object_type) {
+        return object_type != kVulkanObjectTypeInstance && object_type != kVulkanObjectTypePhysicalDevice &&
+               object_type != kVulkanObjectTypeDevice && object_type != kVulkanObjectTypeQueue &&
+               object_type != kVulkanObjectTypeCommandBuffer;
+    }
+    static uint64_t MakeEntry(uint64_t handle, VulkanObjectType object_type) {
+        return (uint64_t(UniqueIdMapping::Generation(handle)) << 32) | uint64_t(object_type);
+    }
+
+    Entry *Find(uint64_t handle) const {
+        const uint64_t index = UniqueIdMapping::SlotIndex(handle);
+        if (index >= UniqueIdMapping::kMaxSlots) return nullptr;
+        Entry *segment = segments_[index / kSegmentSize].load(std::memory_order_acquire);
+        return segment ? &segment[index % kSegmentSize] : nullptr;
+    }
+
+    std::unique_ptr<std::atomic<Entry *>[]> segments_;
+};
+#endif
+
 typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
 // Used for GPL and we know there are at most only 4 libraries that should be used
 typedef vvl::concurrent_unordered_map<uint64_t, small_vector<std::shared_ptr<ObjTrackState>, 4>, 6> object_list_map_type;
 
-class ObjectLifetimes : public ValidationObject {
+class ObjectLifetimes final : public ValidationObject {
     using Func = vvl::Func;
     using Struct = vvl::Struct;
     using Field = vvl::Field;
@@ -61,6 +138,10 @@ class ObjectLifetimes : public ValidationObject {
     // Special-case map for swapchain images
     object_map_type swapchain_image_map;
     object_list_map_type linked_graphics_pipeline_map;
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+    // Indexes the objects of object_map and swapchain_image_map
+    WrappedObjectIndex wrapped_object_index;
+#endif
 
     bool null_descriptor_enabled;
 
@@ -84,7 +165,11 @@ class ObjectLifetimes : public ValidationObject {
                            ", already existed. This should not happen and may indicate a "
                            "race condition in the application.",
                            string_VulkanObjectType(object_type), object_handle);
+            return;
         }
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+        wrapped_object_index.Insert(object_handle, object_type);
+#endif
     }
 
     bool ReportUndestroyedInstanceObjects(VkInstance instance, const Location &loc) const;
@@ -145,13 +230,15 @@ class ObjectLifetimes : public ValidationObject {
             num_objects[object_type]++;
             num_total_objects++;
 
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
+            if (object_type == kVulkanObjectTypeDescriptorPool || object_type == kVulkanObjectTypeCommandPool) {
                 pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
             }
         }
     }
 
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type);
+    // Destroys the child objects of a pool. The caller must hold WriteSharedLock().
+    void DestroyChildObjects(ObjTrackState &pool_node, VulkanObjectType child_type);
 
     template <typename T1>
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type) {
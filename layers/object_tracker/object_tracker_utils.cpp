@@ -32,6 +32,11 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
 }
 
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+    if (wrapped_object_index.Contains(object_handle, object_type)) {
+        return true;
+    }
+#endif
     // Look for object in object map
     if (object_map[object_type].contains(object_handle)) {
         return true;
@@ -152,6 +157,9 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
 
         return;
     }
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+    wrapped_object_index.Erase(object, object_type);
+#endif
     assert(num_total_objects > 0);
 
     num_total_objects--;
@@ -160,6 +168,26 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
     num_objects[item->second->object_type]--;
 }
 
+void ObjectLifetimes::DestroyChildObjects(ObjTrackState &pool_node, VulkanObjectType child_type) {
+    // One lookup per child, and the object counts are updated once for all of them. Children already destroyed by other means
+    // (e.g. as leaked objects) are skipped.
+    auto &child_map = object_map[child_type];
+    uint64_t destroyed_count = 0;
+    for (const uint64_t child : *pool_node.child_objects) {
+        if (child_map.pop(child) != child_map.end()) {
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+            wrapped_object_index.Erase(child, child_type);
+#endif
+            ++destroyed_count;
+        }
+    }
+    pool_node.child_objects->clear();
+
+    assert(num_objects[child_type] >= destroyed_count);
+    num_objects[child_type] -= destroyed_count;
+    num_total_objects -= destroyed_count;
+}
+
 // Destroy memRef lists and free all memory
 void ObjectLifetimes::DestroyQueueDataStructures() {
     // Destroy the items in the queue map
@@ -198,6 +226,11 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc, new_obj_node);
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(command_pool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        itr->second->child_objects->insert(HandleToUint64(command_buffer));
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location &loc) const {
@@ -607,11 +640,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyChildObjects(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
 }
 
@@ -753,6 +782,7 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
+    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
         AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level,
                               record_obj.location.dot(Field::pCommandBuffers, i));
@@ -808,8 +838,17 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    auto lock = WriteSharedLock();
+    std::shared_ptr<ObjTrackState> pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        pool_node = itr->second;
+    }
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
+        if (pool_node) {
+            pool_node->child_objects->erase(HandleToUint64(pCommandBuffers[i]));
+        }
     }
 }
 
@@ -821,6 +860,9 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
         [swapchain](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
         swapchain_image_map.erase(itr.first);
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+        wrapped_object_index.Erase(itr.first, kVulkanObjectTypeImage);
+#endif
     }
 }
 
@@ -890,11 +932,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = WriteSharedLock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyChildObjects(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -902,6 +940,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
 bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                         const VkAllocationCallbacks *pAllocator,
                                                         const ErrorObject &error_obj) const {
+    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkDestroyCommandPool-device-parameter"
 
@@ -909,13 +948,13 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined, error_obj.location);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        for (const uint64_t command_buffer : *itr->second->child_objects) {
+            skip |= ValidateCommandBuffer(commandPool, CastFromUint64<VkCommandBuffer>(command_buffer), command_pool_loc);
+            skip |= ValidateDestroyObject(CastFromUint64<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer, nullptr,
+                                          kVUIDUndefined, kVUIDUndefined, error_obj.location);
+        }
     }
     skip |=
         ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator, "VUID-vkDestroyCommandPool-commandPool-00042",
@@ -925,11 +964,11 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+    auto lock = WriteSharedLock();
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        DestroyChildObjects(*itr->second, kVulkanObjectTypeCommandBuffer);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
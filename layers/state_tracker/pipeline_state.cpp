@@ -90,7 +90,7 @@ std::vector<ShaderStageState> Pipeline::GetStageStates(const ValidationStateTrac
                     // This support was also added in VK_KHR_maintenance5
                     if (const auto shader_ci = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)) {
                         // don't need to worry about GroupDecoration in GPL
-                        auto spirv_module = std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode, stateless_data);
+                        auto spirv_module = state_data.CreateSpirvModule(shader_ci->codeSize, shader_ci->pCode, stateless_data);
                         module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
                         if (stateless_data) {
                             stateless_data->pipeline_pnext_module = spirv_module;
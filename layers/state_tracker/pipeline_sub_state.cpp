@@ -85,11 +85,16 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTrac
                 // don't need to worry about GroupDecoration in GPL
                 spirv::StatelessData *stateless_data_stage =
                     (stateless_data && i < kCommonMaxGraphicsShaderStages) ? &stateless_data[i] : nullptr;
-                auto spirv_module = std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
-                module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
-                if (stateless_data_stage) {
-                    stateless_data_stage->pipeline_pnext_module = spirv_module;
+                // The module might already have been parsed by ValidationStateTracker::ParseStageShaderModules()
+                std::shared_ptr<spirv::Module> spirv_module =
+                    stateless_data_stage ? stateless_data_stage->pipeline_pnext_module : nullptr;
+                if (!spirv_module) {
+                    spirv_module = state_data.CreateSpirvModule(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
+                    if (stateless_data_stage) {
+                        stateless_data_stage->pipeline_pnext_module = spirv_module;
+                    }
                 }
+                module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
             }
         }
 
@@ -200,12 +205,16 @@ void SetFragmentShaderInfoPrivate(FragmentShaderState &fs_state, const Validatio
                     // don't need to worry about GroupDecoration in GPL
                     spirv::StatelessData *stateless_data_stage =
                         (stateless_data && i < kCommonMaxGraphicsShaderStages) ? &stateless_data[i] : nullptr;
-                    auto spirv_module =
-                        std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
-                    module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
-                    if (stateless_data_stage) {
-                        stateless_data_stage->pipeline_pnext_module = spirv_module;
+                    // The module might already have been parsed by ValidationStateTracker::ParseStageShaderModules()
+                    std::shared_ptr<spirv::Module> spirv_module =
+                        stateless_data_stage ? stateless_data_stage->pipeline_pnext_module : nullptr;
+                    if (!spirv_module) {
+                        spirv_module = state_data.CreateSpirvModule(shader_ci->codeSize, shader_ci->pCode, stateless_data_stage);
+                        if (stateless_data_stage) {
+                            stateless_data_stage->pipeline_pnext_module = spirv_module;
+                        }
                     }
+                    module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module);
                 }
             }
 
@@ -494,6 +494,20 @@ vvl::unordered_set<uint32_t> EntryPoint::GetAccessibleIds(const Module& module_s
     return result_ids;
 }
 
+vvl::unordered_set<uint32_t> EntryPoint::GetCachedAccessibleIds(const Module& module_state, EntryPoint& entrypoint,
+                                                                const StaticAnalysis::EntryPointIds& ids) {
+    entrypoint.emit_vertex_geometry = ids.emit_vertex_geometry;
+    vvl::unordered_set<uint32_t> result_ids;
+    result_ids.reserve(ids.accessible_ids.size());
+    for (const uint32_t id : ids.accessible_ids) {
+        // Same as GetAccessibleIds(), only ids with a definition are kept
+        if (module_state.FindDef(id)) {
+            result_ids.insert(id);
+        }
+    }
+    return result_ids;
+}
+
 std::vector<StageInterfaceVariable> EntryPoint::GetStageInterfaceVariables(const Module& module_state, const EntryPoint& entrypoint,
                                                                            const VariableAccessMap& variable_access_map,
                                                                            const DebugNameMap& debug_name_map) {
@@ -757,7 +771,7 @@ ImageAccess::ImageAccess(const Module& module_state, const Instruction& image_in
 
 EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint_insn, const ImageAccessMap& image_access_map,
                        const AccessChainVariableMap& access_chain_map, const VariableAccessMap& variable_access_map,
-                       const DebugNameMap& debug_name_map)
+                       const DebugNameMap& debug_name_map, const StaticAnalysis::EntryPointIds* cached_ids)
     : entrypoint_insn(entrypoint_insn),
       execution_model(spv::ExecutionModel(entrypoint_insn.Word(1))),
       stage(static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(execution_model))),
@@ -765,7 +779,7 @@ EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint
       name(entrypoint_insn.GetAsString(3)),
       execution_mode(module_state.GetExecutionModeSet(id)),
       emit_vertex_geometry(false),
-      accessible_ids(GetAccessibleIds(module_state, *this)),
+      accessible_ids(cached_ids ? GetCachedAccessibleIds(module_state, *this, *cached_ids) : GetAccessibleIds(module_state, *this)),
       resource_interface_variables(GetResourceInterfaceVariables(module_state, *this, image_access_map, access_chain_map,
                                                                  variable_access_map, debug_name_map)),
       stage_interface_variables(GetStageInterfaceVariables(module_state, *this, variable_access_map, debug_name_map)) {
@@ -844,7 +858,97 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
     return result;
 }
 
-Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
+// Bump when the content of StaticAnalysis changes, so data saved by an older version is not used
+static constexpr uint32_t kStaticAnalysisVersion = 2;
+
+void StaticAnalysis::Serialize(std::vector<uint32_t>& out) const {
+    out.push_back(kStaticAnalysisVersion);
+    out.push_back(word_count);
+    out.push_back(static_cast<uint32_t>(content_hash));
+    out.push_back(static_cast<uint32_t>(content_hash >> 32));
+    out.push_back(static_cast<uint32_t>(entry_points.size()));
+    for (const auto& entry_point : entry_points) {
+        out.push_back(entry_point.emit_vertex_geometry ? 1u : 0u);
+        out.push_back(static_cast<uint32_t>(entry_point.accessible_ids.size()));
+        out.insert(out.end(), entry_point.accessible_ids.begin(), entry_point.accessible_ids.end());
+    }
+    out.push_back(static_cast<uint32_t>(func_parameter_map.size()));
+    for (const auto& [param, args] : func_parameter_map) {
+        out.push_back(param);
+        out.push_back(static_cast<uint32_t>(args.size()));
+        out.insert(out.end(), args.begin(), args.end());
+    }
+}
+
+bool StaticAnalysis::Deserialize(vvl::span<const uint32_t> data) {
+    valid = false;
+    entry_points.clear();
+    func_parameter_map.clear();
+
+    size_t pos = 0;
+    auto read = [&data, &pos](uint32_t& value) {
+        if (pos >= data.size()) return false;
+        value = data[pos++];
+        return true;
+    };
+    // Reads a count followed by that many words
+    auto read_list = [&data, &pos, &read](std::vector<uint32_t>& list) {
+        uint32_t count = 0;
+        if (!read(count) || count > data.size() - pos) return false;
+        list.assign(data.begin() + pos, data.begin() + pos + count);
+        pos += count;
+        return true;
+    };
+
+    uint32_t version = 0;
+    uint32_t hash_low = 0;
+    uint32_t hash_high = 0;
+    uint32_t entry_point_count = 0;
+    if (!read(version) || version != kStaticAnalysisVersion || !read(word_count) || !read(hash_low) || !read(hash_high) ||
+        !read(entry_point_count)) {
+        return false;
+    }
+    content_hash = (static_cast<uint64_t>(hash_high) << 32) | hash_low;
+    for (uint32_t i = 0; i < entry_point_count; i++) {
+        auto& entry_point = entry_points.emplace_back();
+        uint32_t emit_vertex_geometry = 0;
+        if (!read(emit_vertex_geometry) || !read_list(entry_point.accessible_ids)) {
+            return false;
+        }
+        entry_point.emit_vertex_geometry = emit_vertex_geometry != 0;
+    }
+    uint32_t param_count = 0;
+    if (!read(param_count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < param_count; i++) {
+        uint32_t param = 0;
+        if (!read(param) || !read_list(func_parameter_map[param])) {
+            return false;
+        }
+    }
+    valid = pos == data.size();
+    return valid;
+}
+
+// ImageAccess follows the map from each OpFunctionParameter to the call arguments without checking the ids, so a cached map
+// must only name definitions that exist in the module
+static bool IsFuncParameterMapValid(const Module& module_state, const FuncParameterMap& func_parameter_map) {
+    for (const auto& [param, args] : func_parameter_map) {
+        const Instruction* param_insn = module_state.FindDef(param);
+        if (!param_insn || param_insn->Opcode() != spv::OpFunctionParameter) {
+            return false;
+        }
+        for (const uint32_t arg : args) {
+            if (!module_state.FindDef(arg)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data, StaticAnalysis* analysis) {
     if (!module_state.valid_spirv) return;
 
     // Parse the words first so we have instruction class objects to use
@@ -1112,20 +1216,38 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         }
     }
 
-    FuncParameterMap func_parameter_map;
-    const uint32_t first_arg_word = 4;
-    for (const auto& func_def : func_parameter_list) {
-        const uint32_t func_id = func_def.first;
-        for (const Instruction* func_call : func_call_instructions) {
-            if (func_call->Word(3) != func_id) {
-                continue;
-            }
-            // guaranteed number of args/params is same
-            const uint32_t arg_count = (func_call->Length() - first_arg_word);
-            for (uint32_t i = 0; i < arg_count; i++) {
-                const uint32_t arg = func_call->Word(first_arg_word + i);
-                const uint32_t param = func_def.second[i];
-                func_parameter_map[param].push_back(arg);
+    // Only trust a previous analysis if it was made for these exact words and its ids still line up with this module
+    uint64_t content_hash = 0;
+    if (analysis) {
+        content_hash = hash_util::ShaderContentHash(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t));
+    }
+    const bool use_analysis = analysis && analysis->valid && analysis->word_count == module_state.words_.size() &&
+                              analysis->content_hash == content_hash &&
+                              analysis->entry_points.size() == entry_point_instructions.size() &&
+                              IsFuncParameterMapValid(module_state, analysis->func_parameter_map);
+    if (analysis && !use_analysis) {
+        *analysis = StaticAnalysis();
+        analysis->word_count = static_cast<uint32_t>(module_state.words_.size());
+        analysis->content_hash = content_hash;
+    }
+
+    FuncParameterMap local_func_parameter_map;
+    FuncParameterMap& func_parameter_map = analysis ? analysis->func_parameter_map : local_func_parameter_map;
+    if (!use_analysis) {
+        const uint32_t first_arg_word = 4;
+        for (const auto& func_def : func_parameter_list) {
+            const uint32_t func_id = func_def.first;
+            for (const Instruction* func_call : func_call_instructions) {
+                if (func_call->Word(3) != func_id) {
+                    continue;
+                }
+                // guaranteed number of args/params is same
+                const uint32_t arg_count = (func_call->Length() - first_arg_word);
+                for (uint32_t i = 0; i < arg_count; i++) {
+                    const uint32_t arg = func_call->Word(first_arg_word + i);
+                    const uint32_t param = func_def.second[i];
+                    func_parameter_map[param].push_back(arg);
+                }
             }
         }
     }
@@ -1199,9 +1321,18 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     }
 
     // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
-    for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map,
-                                                               variable_access_map, debug_name_map));
+    for (size_t i = 0; i < entry_point_instructions.size(); i++) {
+        const StaticAnalysis::EntryPointIds* cached_ids = use_analysis ? &analysis->entry_points[i] : nullptr;
+        const auto& entry_point = entry_points.emplace_back(std::make_shared<EntryPoint>(
+            module_state, *entry_point_instructions[i], image_access_map, access_chain_map, variable_access_map, debug_name_map,
+            cached_ids));
+        if (analysis && !use_analysis) {
+            analysis->entry_points.push_back({entry_point->emit_vertex_geometry,
+                                              {entry_point->accessible_ids.begin(), entry_point->accessible_ids.end()}});
+        }
+    }
+    if (analysis) {
+        analysis->valid = true;
     }
 }
 
@@ -252,6 +252,31 @@ using AccessChainVariableMap = vvl::unordered_map<uint32_t, std::vector<const In
 // Mapping of OpName instructions
 using DebugNameMap = vvl::unordered_map<uint32_t, const Instruction *>;
 
+// Results of the walks over the whole module that are the most expensive part of building the StaticData, but only depend on
+// the SPIR-V words. They only hold <id>s, so they can be serialized, saved in the ValidationCache and handed back to a Module
+// parsed from the same words in a later run.
+struct StaticAnalysis {
+    // Set once the content matches the module, either from Deserialize() or filled in while parsing
+    bool valid = false;
+    // Number of words and hash of the content of the module it was made for. The cache is keyed by the 32-bit
+    // ShaderHash(), these guard against collisions and corrupt records.
+    uint32_t word_count = 0;
+    uint64_t content_hash = 0;
+
+    FuncParameterMap func_parameter_map;
+
+    struct EntryPointIds {
+        bool emit_vertex_geometry = false;
+        std::vector<uint32_t> accessible_ids;
+    };
+    // In the order of the OpEntryPoint instructions
+    std::vector<EntryPointIds> entry_points;
+
+    void Serialize(std::vector<uint32_t> &out) const;
+    // Returns false (and leaves the object invalid) if the data is truncated or was written by a different version
+    bool Deserialize(vvl::span<const uint32_t> data);
+};
+
 // A slot is a <Location, Component> mapping
 struct InterfaceSlot {
     // A Location is made up of 4 Components
@@ -532,12 +557,15 @@ struct EntryPoint {
     bool has_passthrough{false};
     bool has_alpha_to_coverage_variable{false};  // only for Fragment shaders
 
+    // cached_ids are the accessible_ids found by a previous parse of the same module, if any (see StaticAnalysis)
     EntryPoint(const Module &module_state, const Instruction &entrypoint_insn, const ImageAccessMap &image_access_map,
                const AccessChainVariableMap &access_chain_map, const VariableAccessMap &variable_access_map,
-               const DebugNameMap &debug_name_map);
+               const DebugNameMap &debug_name_map, const StaticAnalysis::EntryPointIds *cached_ids = nullptr);
 
   protected:
     static vvl::unordered_set<uint32_t> GetAccessibleIds(const Module &module_state, EntryPoint &entrypoint);
+    static vvl::unordered_set<uint32_t> GetCachedAccessibleIds(const Module &module_state, EntryPoint &entrypoint,
+                                                               const StaticAnalysis::EntryPointIds &ids);
     static std::vector<StageInterfaceVariable> GetStageInterfaceVariables(const Module &module_state, const EntryPoint &entrypoint,
                                                                           const VariableAccessMap &variable_access_map,
                                                                           const DebugNameMap &debug_name_map);
@@ -579,7 +607,7 @@ struct Module {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr);
+        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr, StaticAnalysis *analysis = nullptr);
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
@@ -655,10 +683,11 @@ struct Module {
     Module(vvl::span<const uint32_t> code) : valid_spirv(true), words_(code.begin(), code.end()), static_data_(*this) {}
 
     // StatelessData is a pointer as we have cases were we don't need it and simpler to just null check the few cases that use it
-    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr)
+    // If analysis is valid, it is used instead of walking the module again, otherwise it is filled in
+    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr, StaticAnalysis *analysis = nullptr)
         : valid_spirv(pCode && pCode[0] == spv::MagicNumber && ((codeSize % 4) == 0)),
           words_(pCode, pCode + codeSize / sizeof(uint32_t)),
-          static_data_(*this, stateless_data) {}
+          static_data_(*this, stateless_data, analysis) {}
 
     const Instruction *FindDef(uint32_t id) const {
         auto it = static_data_.definitions.find(id);
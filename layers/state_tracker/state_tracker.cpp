@@ -25,6 +25,8 @@
 
 #include "containers/custom_containers.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/hash_util.h"
+#include "utils/shader_utils.h"
 
 #include "generated/chassis.h"
 #include "state_tracker/state_tracker.h"
@@ -39,6 +41,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/ray_tracing_state.h"
 #include "state_tracker/shader_object_state.h"
+#include "state_tracker/shader_module.h"
 #include "chassis/chassis_modification_state.h"
 #include "spirv-tools/optimizer.hpp"
 
@@ -1879,6 +1882,57 @@ std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateGraphicsPipelineSta
                                            stateless_data);
 }
 
+// Parses the VkShaderModuleCreateInfo found in the pNext of the pipeline stages up front, spread over multiple threads.
+// The result is left in StatelessData::pipeline_pnext_module, where the PreRasterState and FragmentShaderState constructors pick
+// it up instead of parsing the module themselves.
+void ValidationStateTracker::ParseStageShaderModules(uint32_t count, const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                     const std::vector<spirv::StatelessData *> &stateless_data) const {
+    struct ParseJob {
+        const VkShaderModuleCreateInfo *create_info;
+        spirv::StatelessData *stateless_data;
+    };
+    std::vector<ParseJob> jobs;
+    for (uint32_t i = 0; i < count; i++) {
+        const auto &create_info = pCreateInfos[i];
+        // Only gather the stages the sub states will look at, pStages is ignored otherwise
+        const auto lib_type = GetGraphicsLibType(create_info);
+        const bool is_linked = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(create_info.pNext) != nullptr;
+        const bool complete_pipeline = lib_type == 0 && !is_linked;
+        const bool pre_raster_stages =
+            complete_pipeline || (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+        const bool fragment_stage = complete_pipeline || (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+        if (!pre_raster_stages && !fragment_stage) {
+            continue;
+        }
+
+        const uint32_t stage_count = std::min(create_info.stageCount, kCommonMaxGraphicsShaderStages);
+        for (uint32_t stage = 0; stage < stage_count; stage++) {
+            const auto &stage_ci = create_info.pStages[stage];
+            const bool is_fragment = stage_ci.stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+            if (is_fragment ? !fragment_stage : !pre_raster_stages) {
+                continue;
+            }
+            if (Get<vvl::ShaderModule>(stage_ci.module)) {
+                continue;
+            }
+            if (const auto shader_ci = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)) {
+                jobs.emplace_back(ParseJob{shader_ci, &stateless_data[i][stage]});
+            }
+        }
+    }
+    // A single module is not worth handing off to another thread
+    if (jobs.size() < 2) {
+        return;
+    }
+
+    shader_parsing_pool_.ParallelFor(static_cast<uint32_t>(jobs.size()), [this, &jobs](uint32_t index) {
+        const ParseJob &job = jobs[index];
+        // don't need to worry about GroupDecoration in GPL
+        job.stateless_data->pipeline_pnext_module =
+            CreateSpirvModule(job.create_info->codeSize, job.create_info->pCode, job.stateless_data);
+    });
+}
+
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                     const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                                     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -1888,6 +1942,19 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
     pipeline_states.reserve(count);
     auto pipeline_cache = Get<vvl::PipelineCache>(pipelineCache);
+
+    // Only the first pipeline's StatelessData is validated (see CoreChecks::PreCallValidateCreateGraphicsPipelines), but each
+    // pipeline needs its own so modules parsed for one pipeline are not mistaken for another's
+    std::vector<spirv::StatelessData> extra_stateless_data(size_t(count > 1 ? count - 1 : 0) * kCommonMaxGraphicsShaderStages);
+    std::vector<spirv::StatelessData *> stateless_data(count);
+    for (uint32_t i = 0; i < count; i++) {
+        stateless_data[i] =
+            (i == 0) ? chassis_state.stateless_data : &extra_stateless_data[size_t(i - 1) * kCommonMaxGraphicsShaderStages];
+    }
+    if (global_settings.parallel_shader_parsing) {
+        ParseStageShaderModules(count, pCreateInfos, stateless_data);
+    }
+
     for (uint32_t i = 0; i < count; i++) {
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<vvl::PipelineLayout>(create_info.layout);
@@ -1910,7 +1977,7 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
         }
 
         pipeline_states.push_back(CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
-                                                              std::move(layout_state), chassis_state.stateless_data));
+                                                              std::move(layout_state), stateless_data[i]));
     }
     return skip;
 }
@@ -4734,6 +4801,29 @@ void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirect2KHR(VkCommandBuf
     cb_state->UpdateTraceRayCmd(record_obj.location.function);
 }
 
+std::shared_ptr<spirv::Module> ValidationStateTracker::CreateSpirvModule(size_t code_size, const uint32_t *code,
+                                                                         spirv::StatelessData *stateless_data) const {
+    ValidationCache *cache = GetShaderAnalysisCache();
+    if (!cache || !code || code_size == 0) {
+        return std::make_shared<spirv::Module>(code_size, code, stateless_data);
+    }
+
+    const uint32_t hash = hash_util::ShaderHash(code, code_size);
+    spirv::StaticAnalysis analysis;
+    std::vector<uint32_t> analysis_data;
+    const bool found = cache->FindShaderAnalysis(hash, analysis_data) && analysis.Deserialize(analysis_data);
+
+    auto module_state = std::make_shared<spirv::Module>(code_size, code, stateless_data, &analysis);
+    // On a miss the module fills in the analysis while parsing. A cached analysis that does not match the module (a collision
+    // of the 32-bit hash) is recomputed but not replaced, the record saved first keeps the slot.
+    if (!found && analysis.valid) {
+        analysis_data.clear();
+        analysis.Serialize(analysis_data);
+        cache->InsertShaderAnalysis(hash, std::move(analysis_data));
+    }
+    return module_state;
+}
+
 void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                              const RecordObject &record_obj,
@@ -4742,8 +4832,7 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
         return;
     }
 
-    chassis_state.module_state =
-        std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
+    chassis_state.module_state = CreateSpirvModule(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4773,7 +4862,7 @@ void ValidationStateTracker::PreCallRecordCreateShadersEXT(VkDevice device, uint
         }
         // don't need to worry about GroupDecoration with VK_EXT_shader_object
         if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
-            chassis_state.module_states[i] = std::make_shared<spirv::Module>(
+            chassis_state.module_states[i] = CreateSpirvModule(
                 pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode), &chassis_state.stateless_data[i]);
         }
     }
@@ -28,6 +28,7 @@
 #include "containers/custom_containers.h"
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
+#include "utils/thread_pool.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include <atomic>
 #include <functional>
@@ -76,9 +77,12 @@ struct CreateShaderModule;
 }  // namespace chassis
 
 namespace spirv {
+struct Module;
 struct StatelessData;
 }  // namespace spirv
 
+class ValidationCache;
+
 #define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
     vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;               \
     template <typename Dummy>                                                                         \
@@ -748,6 +752,8 @@ class ValidationStateTracker : public ValidationObject {
         const VkGraphicsPipelineCreateInfo* create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
         std::shared_ptr<const vvl::RenderPass>&& render_pass, std::shared_ptr<const vvl::PipelineLayout>&& layout,
         spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages]) const;
+    void ParseStageShaderModules(uint32_t count, const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                 const std::vector<spirv::StatelessData*>& stateless_data) const;
 
     bool PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                 const VkGraphicsPipelineCreateInfo* pCreateInfos,
@@ -887,6 +893,11 @@ class ValidationStateTracker : public ValidationObject {
     void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator,
                                        const RecordObject& record_obj) override;
 
+    // Cache used to save the spirv::StaticAnalysis of modules between runs, if any
+    virtual ValidationCache* GetShaderAnalysisCache() const { return nullptr; }
+    // Parses a SPIR-V module, reusing the work done for the same code in a previous run when possible
+    std::shared_ptr<spirv::Module> CreateSpirvModule(size_t code_size, const uint32_t* code,
+                                                     spirv::StatelessData* stateless_data) const;
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state) override;
@@ -1849,8 +1860,12 @@ class ValidationStateTracker : public ValidationObject {
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
 
+    // Used to parse the shader modules found in the pNext of pipeline stages on multiple threads (parallel_shader_parsing)
+    mutable vvl::ThreadPool shader_parsing_pool_{0};
+
     using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    // Looked up on every device address validated, and only changed by buffer creation and destruction
+    using BufferAddressRangeMap = sparse_container::flat_range_map<VkDeviceAddress, BufferAddressMapStore>;
 
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
@@ -24,7 +24,7 @@
 #include "generated/chassis.h"
 #include "generated/device_features.h"
 
-class StatelessValidation : public ValidationObject {
+class StatelessValidation final : public ValidationObject {
     using Func = vvl::Func;
     using Struct = vvl::Struct;
     using Field = vvl::Field;
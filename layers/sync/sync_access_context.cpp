@@ -21,6 +21,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/thread_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
@@ -74,6 +75,10 @@ class HazardDetectFirstUse {
 AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
+    // Subpass contexts live no longer than the command buffer context, so they can use its allocator
+    if (external_context) {
+        map_allocator_ = external_context->map_allocator_;
+    }
     Reset();
     const auto &subpass_dep = dependencies[subpass];
     const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
@@ -106,7 +111,7 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 template <typename NormalizeOp>
 void AccessContext::Trim(NormalizeOp &&normalize) {
     ForAll(std::forward<NormalizeOp>(normalize));
-    sparse_container::consolidate(access_state_map_);
+    sparse_container::consolidate(GetAccessStateMap());
 }
 
 void AccessContext::Trim() {
@@ -122,6 +127,24 @@ void AccessContext::TrimAndClearFirstAccess() {
     Trim(normalize);
 }
 
+uint32_t AccessContext::TrimAndClearFirstAccessIncremental(ResourceAddress &cursor, uint32_t entry_budget) {
+    auto &access_state_map = GetAccessStateMap();
+    auto first = access_state_map.lower_bound(ResourceAccessRange(cursor, cursor + 1));
+    // Include the last entry of the previous step, so the first entry of this one can be merged into it
+    if (first != access_state_map.begin()) {
+        --first;
+    }
+    auto last = first;
+    uint32_t visited = 0;
+    for (; last != access_state_map.end() && visited < entry_budget; ++last, ++visited) {
+        last->second.Normalize();
+        last->second.ClearFirstUse();
+    }
+    cursor = (last != access_state_map.end()) ? last->first.begin : 0;
+    sparse_container::consolidate(access_state_map, first, last);
+    return visited;
+}
+
 void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     auto gather = [&used](const ResourceAccessRangeMap::value_type &access) { access.second.GatherReferencedTags(used); };
     ConstForAll(gather);
@@ -129,21 +152,29 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
 
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
-    for (auto &access : access_state_map_) {
+    for (auto &access : GetAccessStateMap()) {
         action(access);
     }
 }
 
 template <typename Action>
 void AccessContext::ConstForAll(Action &&action) const {
-    for (auto &access : access_state_map_) {
+    for (auto &access : GetAccessStateMap()) {
         action(access);
     }
 }
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
+    if (access_state_map_->empty() && from.prev_.empty()) {
+        // Without barriers or previous contexts to resolve, this would be a copy of from's map, so share it instead.
+        // This is the common case of a queue batch importing the accesses of the previous batch. The batch still gets its own
+        // copy as soon as it records an access, while the previous batch holds the map, so this mostly trades the resolve walk
+        // for a plain map copy. The copy is skipped only for batches that never modify the map.
+        access_state_map_ = from.access_state_map_;
+        return;
+    }
     const NoopBarrierAction noop_barrier;
-    from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
+    from.ResolveAccessRange(kFullRange, noop_barrier, &GetAccessStateMap(), nullptr);
 }
 
 void AccessContext::ResolvePreviousAccess(const ResourceAccessRange &range, ResourceAccessRangeMap *descent_map,
@@ -176,7 +207,7 @@ void AccessContext::ResolvePreviousAccesses() {
     ResourceAccessState default_state;
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
-    ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
+    ResolvePreviousAccess(kFullRange, &GetAccessStateMap(), &default_state);
 }
 
 void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -187,9 +218,10 @@ void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccess
     if (!SimpleBinding(buffer)) {
         return;
     }
+    const auto timer = syncval_stats::TimeUpdateAccessState();
     const auto base_address = ResourceBaseAddress(buffer);
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag_ex);
-    UpdateMemoryAccessRangeState(access_state_map_, action, range + base_address);
+    UpdateMemoryAccessRangeState(GetAccessStateMap(), action, range + base_address);
 }
 
 void AccessContext::UpdateAccessState(const ImageState &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -243,6 +275,7 @@ void AccessContext::UpdateAccessState(ImageRangeGen &range_gen, SyncStageAccessI
     if (current_usage == SYNC_ACCESS_INDEX_NONE) {
         return;
     }
+    const auto timer = syncval_stats::TimeUpdateAccessState();
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, ResourceUsageTagEx{tag});
     UpdateMemoryAccessState(action, range_gen);
 }
@@ -258,7 +291,7 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
-        context.ResolveAccessRange(kFullRange, barrier_action, &access_state_map_, nullptr, false);
+        context.ResolveAccessRange(kFullRange, barrier_action, &GetAccessStateMap(), nullptr, false);
     }
 }
 
@@ -539,7 +572,7 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                                  const AccessContext &access_context) const {
     HazardResult hazard;
-    for (const auto &recorded_access : access_state_map_) {
+    for (const auto &recorded_access : GetAccessStateMap()) {
         // Cull any entries not in the current tag range
         if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
         HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
@@ -550,6 +583,57 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
     return hazard;
 }
 
+HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                 const AccessContext &access_context, vvl::ThreadPool &thread_pool) const {
+    // Below this, handing the checks to other threads costs more than doing them
+    constexpr size_t kMinParallelChecks = 64;
+    // More shards than threads, so that a thread finishing early can pick up more work
+    constexpr uint32_t kShardsPerThread = 4;
+
+    std::vector<const ResourceAccessRangeMap::value_type *> recorded_accesses;
+    for (const auto &recorded_access : GetAccessStateMap()) {
+        if (recorded_access.second.FirstAccessInTagRange(tag_range)) {
+            recorded_accesses.emplace_back(&recorded_access);
+        }
+    }
+    auto detect = [queue_id, &tag_range, &access_context](const ResourceAccessRangeMap::value_type &recorded_access) {
+        HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
+        return access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+    };
+
+    if (recorded_accesses.size() < kMinParallelChecks) {
+        HazardResult hazard;
+        for (const auto *recorded_access : recorded_accesses) {
+            hazard = detect(*recorded_access);
+            if (hazard.IsHazard()) break;
+        }
+        return hazard;
+    }
+
+    // Hazard detection only reads access_context, so the recorded accesses can be checked in any order. Each shard is a
+    // contiguous run of recorded accesses, in address order. The serial version reports the hazard with the lowest address,
+    // which is the first one found by the lowest shard that has any. Shards stop once a lower shard found a hazard.
+    const uint32_t shard_count = static_cast<uint32_t>(
+        std::min<size_t>(recorded_accesses.size(), (thread_pool.ThreadCount() + 1) * kShardsPerThread));
+    std::vector<HazardResult> shard_hazards(shard_count);
+    std::atomic<uint32_t> first_hazard_shard{shard_count};
+    thread_pool.ParallelFor(shard_count, [&](uint32_t shard) {
+        const size_t begin = recorded_accesses.size() * shard / shard_count;
+        const size_t end = recorded_accesses.size() * (shard + 1) / shard_count;
+        for (size_t i = begin; i < end && first_hazard_shard.load(std::memory_order_relaxed) > shard; ++i) {
+            HazardResult hazard = detect(*recorded_accesses[i]);
+            if (hazard.IsHazard()) {
+                shard_hazards[shard] = std::move(hazard);
+                vvl::atomic_fetch_min(first_hazard_shard, shard);
+                break;
+            }
+        }
+    });
+
+    const uint32_t first_shard = first_hazard_shard.load();
+    return first_shard < shard_count ? std::move(shard_hazards[first_shard]) : HazardResult();
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
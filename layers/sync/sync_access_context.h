@@ -19,11 +19,16 @@
 
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
+#include "sync/sync_stats.h"
+
+#include <atomic>
+#include <memory>
 
 struct SubpassDependencyGraphNode;
 
 namespace vvl {
 class Buffer;
+class ThreadPool;
 class VideoSession;
 class VideoPictureResource;
 class Bindable;
@@ -46,6 +51,7 @@ VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer);
 // Action must handle pos == end correctly
 // Action is assumed to only require invocation once per map entry
 // RangeGen must be strictly monotonic
+// Abutting generated ranges are passed to Action as a single range
 // Note: If Action invocations are heavyweight and inter-entry (gap) calls are not needed
 //       add a template or function parameter to skip them. TBD.
 template <typename RangeMap, typename RangeGen, typename Action>
@@ -55,8 +61,12 @@ bool ForEachEntryInRangesUntil(const RangeMap &map, RangeGen &range_gen, Action
     auto pos = map.lower_bound(*range_gen);
     const auto end = map.end();
     IndexType skip_limit = 0;
-    for (; range_gen->non_empty() && pos != end; ++range_gen) {
+    while (range_gen->non_empty()) {
         RangeType range = *range_gen;
+        for (++range_gen; range_gen->non_empty() && (range_gen->begin == range.end); ++range_gen) {
+            range.end = range_gen->end;
+        }
+
         // See if a prev pos has covered this range
         if (range.end <= skip_limit) {
             // Since the map is const, we needn't call action on the same pos again
@@ -69,30 +79,22 @@ bool ForEachEntryInRangesUntil(const RangeMap &map, RangeGen &range_gen, Action
             range.begin = skip_limit;
         }
 
-        // Now advance pos as needed to match range
-        if (pos->first.strictly_less(range)) {
-            ++pos;
-            if (pos == end) break;
-            if (pos->first.strictly_less(range)) {
-                pos = map.lower_bound(range);
-                if (pos == end) break;
-            }
-            assert(pos == map.lower_bound(range));
+        // Now advance pos as needed to match range. Action needs to handle the "at end" condition (and can be useful for
+        // recursive actions)
+        if ((pos != end) && pos->first.strictly_less(range)) {
+            pos = sparse_container::seek_lower_bound(map, pos, range);
         }
 
         // If the range intersects pos->first, consider Action performed for that map entry, and
         // make sure not to call Action for this pos for any subsequent ranges
-        skip_limit = range.end > pos->first.begin ? pos->first.end : 0U;
+        if (pos != end) {
+            skip_limit = range.end > pos->first.begin ? pos->first.end : 0U;
+        }
 
         // Action is allowed to alter pos but shouldn't do so if range is strictly < pos->first
         if (action(range, end, pos)) return true;
     }
 
-    // Action needs to handle the "at end " condition (and can be useful for recursive actions)
-    for (; range_gen->non_empty(); ++range_gen) {
-        if (action(*range_gen, end, pos)) return true;
-    }
-
     return false;
 }
 
@@ -286,6 +288,9 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                       const AccessContext &access_context) const;
+    // Same result as the serial version, with the checks of the recorded accesses split over thread_pool
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::ThreadPool &thread_pool) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -295,7 +300,12 @@ class AccessContext {
         src_external_ = nullptr;
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
-        access_state_map_.clear();
+        access_state_map_ = std::make_shared<ResourceAccessRangeMap>(std::in_place, map_allocator_);
+    }
+    // Maps created by later resets allocate their entries with map_allocator
+    void Reset(const ResourceAccessMapAllocator &map_allocator) {
+        map_allocator_ = map_allocator;
+        Reset();
     }
 
     void ResolvePreviousAccesses();
@@ -343,10 +353,26 @@ class AccessContext {
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Does the work of TrimAndClearFirstAccess for at most entry_budget entries, starting at the entry containing or following
+    // cursor. Updates cursor to where the next call should continue (0 when the end of the map was reached), and returns the
+    // number of entries visited.
+    uint32_t TrimAndClearFirstAccessIncremental(ResourceAddress &cursor, uint32_t entry_budget);
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
-    const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
+    // Copies of a context share their map until one of them modifies it, which is when the private copy of the map is made.
+    // That copy still shares the entries, see shared_chunk_map, and allocates like the maps this context creates, so a command
+    // buffer context keeps the entries it modifies in its arena. When this context turns out to be the only owner left, the
+    // acquire fence makes the writes of the other owners, made before they released the map, visible here.
+    ResourceAccessRangeMap &GetAccessStateMap() {
+        if (access_state_map_.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } else {
+            access_state_map_ = std::make_shared<ResourceAccessRangeMap>(
+                std::in_place, access_state_map_->get_implementation_map(), map_allocator_);
+        }
+        return *access_state_map_;
+    }
+    const ResourceAccessRangeMap &GetAccessStateMap() const { return *access_state_map_; }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -454,7 +480,8 @@ class AccessContext {
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
-    ResourceAccessRangeMap access_state_map_;
+    std::shared_ptr<ResourceAccessRangeMap> access_state_map_;
+    ResourceAccessMapAllocator map_allocator_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
@@ -492,7 +519,7 @@ struct ActionToOpsAdapter {
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
-    UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
+    UpdateMemoryAccessRangeState(GetAccessStateMap(), barrier_action, kFullRange);
 }
 
 template <typename Action>
@@ -505,7 +532,7 @@ void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesse
 template <typename Action, typename RangeGen>
 void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
     ActionToOpsAdapter<Action> ops{action};
-    infill_update_rangegen(access_state_map_, range_gen, ops);
+    infill_update_rangegen(GetAccessStateMap(), range_gen, ops);
 }
 
 template <typename Action>
@@ -537,7 +564,7 @@ HazardResult AccessContext::DetectAsyncHazard(const Detector &detector, const Ra
         return false;
     };
 
-    ForEachEntryInRangesUntil(access_state_map_, range_gen, do_async_hazard_check);
+    ForEachEntryInRangesUntil(GetAccessStateMap(), range_gen, do_async_hazard_check);
 
     return hazard;
 }
@@ -592,7 +619,7 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
                                        bool recur_to_infill) const {
     if (!range.non_empty()) return;
 
-    ResourceRangeMergeIterator current(*resolve_map, access_state_map_, range.begin);
+    ResourceRangeMergeIterator current(*resolve_map, GetAccessStateMap(), range.begin);
     while (current->range.non_empty() && range.includes(current->range.begin)) {
         const auto current_range = current->range & range;
         if (current->pos_B->valid) {
@@ -654,6 +681,7 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
 // the DAG of the contexts (for example subpasses)
 template <typename Detector, typename RangeGen>
 HazardResult AccessContext::DetectHazardGeneratedRanges(Detector &detector, RangeGen &range_gen, DetectOptions options) const {
+    const auto timer = syncval_stats::TimeDetectHazard();
     HazardResult hazard;
 
     // Do this before range_gen is incremented s.t. the copies used will be correct
@@ -676,7 +704,7 @@ HazardResult AccessContext::DetectHazardGeneratedRanges(Detector &detector, Rang
         return hazard.IsHazard();
     };
 
-    ForEachEntryInRangesUntil(access_state_map_, range_gen, do_detect_hazard_range);
+    ForEachEntryInRangesUntil(GetAccessStateMap(), range_gen, do_detect_hazard_range);
 
     return hazard;
 }
@@ -696,20 +724,20 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
 template <typename Predicate>
 void AccessContext::EraseIf(Predicate &&pred) {
     // Note: Don't forward, we don't want r-values moved, since we're going to make multiple calls.
-    vvl::EraseIf(access_state_map_, pred);
+    vvl::EraseIf(GetAccessStateMap(), pred);
 }
 
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
-    from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
+    from_context.ResolveAccessRange(kFullRange, resolve_op, &GetAccessStateMap(), infill_state, recur_to_infill);
 }
 
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, RangeGenerator range_gen,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
     for (; range_gen->non_empty(); ++range_gen) {
-        from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
+        from_context.ResolveAccessRange(*range_gen, resolve_op, &GetAccessStateMap(), infill_state, recur_to_infill);
     }
 }
 
@@ -62,7 +62,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.AccessBit(), read_access.TagEx());
                     break;
                 }
             }
@@ -114,7 +114,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         return DetectBarrierHazard(usage_info, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        const bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
+        const bool usage_write_is_ordered = usage_bit.Intersects(ordering.access_scope);
         if (last_reads.size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = VK_PIPELINE_STAGE_2_NONE;
@@ -127,7 +127,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
                 for (const auto &read_access : last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.AccessBit(), read_access.TagEx());
                         break;
                     }
                 }
@@ -137,7 +137,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
             if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (last_write->IsIndex(SYNC_IMAGE_LAYOUT_TRANSITION))) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
-                ilt_ilt_hazard = !(last_write->Barriers() & ordering.access_scope).any();
+                ilt_ilt_hazard = !last_write->Barriers().Intersects(ordering.access_scope);
             }
             if (ilt_ilt_hazard || last_write->IsWriteHazard(usage_info)) {
                 hazard.Set(this, usage_info, WRITE_AFTER_WRITE, *last_write);
@@ -227,7 +227,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const SyncStageAccessInfoTyp
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
                 if (read_access.queue == queue_id && read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.access, read_access.TagEx());
+                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.AccessBit(), read_access.TagEx());
                     break;
                 }
             }
@@ -265,7 +265,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.AccessBit(), read_access.TagEx());
                 break;
             }
         }
@@ -306,21 +306,21 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.TagEx());
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.AccessBit(), current_read.TagEx());
                 } else {
                     // The read is in the events first synchronization scope, so we use a barrier hazard check
                     // If the read stage is not in the src sync scope
                     // *AND* not execution chained with an existing sync barrier (that's the or)
                     // then the barrier access is unsafe (R/W after R)
                     if (scope_read.IsReadBarrierHazard(event_queue, src_exec_scope, src_access_scope)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.access, scope_read.TagEx());
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.AccessBit(), scope_read.TagEx());
                         break;
                     }
                 }
             }
             if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
                 const ReadState &current_read = last_reads[scope_read_count];
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.TagEx());
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.AccessBit(), current_read.TagEx());
             }
         } else if (last_write.has_value()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
@@ -353,7 +353,7 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
                 if (other_read.stage == my_read.stage) {
                     if (my_read.tag < other_read.tag) {
                         // Other is more recent, copy in the state
-                        my_read.access = other_read.access;
+                        my_read.access_index = other_read.access_index;
                         my_read.tag = other_read.tag;
                         my_read.handle_index = other_read.handle_index;
                         my_read.queue = other_read.queue;
@@ -465,7 +465,7 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
             const auto not_usage_stage = ~usage_stage;
             for (auto &read_access : last_reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag_ex);
+                    read_access.Set(usage_stage, usage_info.stage_access_index, 0, tag_ex);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -482,7 +482,7 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag_ex);
+            last_reads.emplace_back(usage_stage, usage_info.stage_access_index, 0, tag_ex);
             last_read_stages |= usage_stage;
         }
 
@@ -646,17 +646,16 @@ void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     }
 }
 
-static const SyncStageAccessFlags kAllSyncStageAccessBits = ~SyncStageAccessFlags(0);
 ResourceAccessState::ResourceAccessState()
     : last_write(),
       last_read_stages(0),
       read_execution_barriers(VK_PIPELINE_STAGE_2_NONE),
       last_reads(),
-      input_attachment_read(false),
-      pending_layout_transition(false),
       first_accesses_(),
       first_read_stages_(VK_PIPELINE_STAGE_2_NONE),
       first_write_layout_ordering_(),
+      input_attachment_read(false),
+      pending_layout_transition(false),
       first_access_closed_(false) {}
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
@@ -664,7 +663,7 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
     VkPipelineStageFlags2KHR barriers = VK_PIPELINE_STAGE_2_NONE;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (usage_bit[read_access.access_index]) {
             barriers = read_access.barriers;
             break;
         }
@@ -785,21 +784,21 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex)
     : stage(stage_),
-      access(access_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
+      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_ex.tag),
       handle_index(tag_ex.handle_index),
       queue(kQueueIdInvalid),
-      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
+      access_index(access_index_) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex) {
     stage = stage_;
-    access = access_;
+    access_index = access_index_;
     barriers = barriers_;
     sync_stages = VK_PIPELINE_STAGE_2_NONE;
     tag = tag_ex.tag;
@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "utils/arena.h"
 
 class ResourceAccessState;
 class ResourceAccessWriteState;
@@ -26,19 +27,19 @@ struct ResourceFirstAccess;
 //       rules apply only to this specific access for this stage, and not the stage as a whole. The ordering detection
 //       also reflects this special case for read hazard detection (using access instead of exec scope)
 constexpr VkPipelineStageFlags2KHR kColorAttachmentExecScope = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR;
-const SyncStageAccessFlags kColorAttachmentAccessScope =
+constexpr SyncStageAccessFlags kColorAttachmentAccessScope =
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_BIT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kDepthStencilAttachmentExecScope =
     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR;
-const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
+constexpr SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
     SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
-const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
+constexpr SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
 enum SyncHazard {
     NONE = 0,
@@ -273,23 +274,27 @@ class ResourceAccessState : public SyncStageAccess {
     // given the only the second execution scope creates a dependency chain, we have to track each,
     // but only up to one per pipeline stage (as another read from the *same* stage become more recent,
     // and applicable one for hazard detection
+    //
+    // Every range of every resource has its own copy of these, so the fields are ordered to avoid padding, and the access is
+    // kept as an index rather than as a (single bit) SyncStageAccessFlags mask.
     struct ReadState {
-        VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
-        VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
-        VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
+        VkPipelineStageFlags2KHR stage;              // The stage of this read
+        VkPipelineStageFlags2KHR barriers;           // all applicable barriered stages
+        VkPipelineStageFlags2KHR sync_stages;        // reads known to have happened after this
+        VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
+                                                     // Excluded from comparison
         ResourceUsageTag tag;
         uint32_t handle_index;
         QueueId queue;
-        VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
-                                                     // Excluded from comparison
+        SyncStageAccessIndex access_index;  // TODO: Revisit whether this needs to support multiple reads per stage
+
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTagEx tag_ex);
         ResourceUsageTagEx TagEx() const { return {tag, handle_index}; }
+        const SyncStageAccessFlags &AccessBit() const { return UsageInfo(access_index).stage_access_bit; }
         bool operator==(const ReadState &rhs) const {
-            return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
+            return (stage == rhs.stage) && (access_index == rhs.access_index) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
                    (pending_dep_chain == rhs.pending_dep_chain);
         }
@@ -324,7 +329,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTagEx tag_ex);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -509,9 +514,14 @@ class ResourceAccessState : public SyncStageAccess {
 
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
-    using ReadStates = small_vector<ReadState, 3, uint32_t>;
+    // Most ranges are read from one or two stages, more reads than that spill to the heap
+    using ReadStates = small_vector<ReadState, 2, uint32_t>;
     ReadStates last_reads;
 
+    FirstAccesses first_accesses_;
+    VkPipelineStageFlags2KHR first_read_stages_;
+    OrderingBarrier first_write_layout_ordering_;
+
     // TODO Input Attachment cleanup for multiple reads in a given stage
     // Tracks whether the fragment shader read is input attachment read
     bool input_attachment_read;
@@ -520,15 +530,22 @@ class ResourceAccessState : public SyncStageAccess {
     // Pending execution state to support independent parallel barriers
     bool pending_layout_transition;
 
-    FirstAccesses first_accesses_;
-    VkPipelineStageFlags2KHR first_read_stages_;
-    OrderingBarrier first_write_layout_ordering_;
     bool first_access_closed_;
 
     static OrderingBarriers kOrderingRules;
 };
+// Every range of every access map holds one of these, keep an eye on the size when adding state (424 bytes on 64-bit builds:
+// 128 for the last write, 136 for the inline reads, 96 for the first accesses)
+static_assert(sizeof(void *) != 8 || sizeof(ResourceAccessState) <= 424, "ResourceAccessState grew");
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// The access maps of command buffers are allocated from a per command buffer arena, other maps use the heap
+using ResourceAccessMapAllocator = vvl::ArenaAllocator<std::pair<const ResourceAccessRange, ResourceAccessState>>;
+// Each queue batch starts from a copy of the map of the previous batch, and only updates the ranges its command buffers access.
+// The chunked map makes these copies share the entries they don't update.
+using ResourceAccessImplMap =
+    sparse_container::shared_chunk_map<ResourceAccessRange, ResourceAccessState, ResourceAccessMapAllocator>;
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange, ResourceAccessImplMap>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -83,6 +83,9 @@ CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator &sync
 CommandBufferAccessContext::CommandBufferAccessContext(SyncValidator &sync_validator, vvl::CommandBuffer *cb_state)
     : CommandBufferAccessContext(sync_validator) {
     cb_state_ = cb_state;
+    arena_ = std::make_shared<vvl::Arena>();
+    cb_access_context_.Reset(ResourceAccessMapAllocator(arena_));
+    handles_ = HandleRecords(HandleRecords::allocator_type(arena_));
     sync_state_->stats.AddCommandBufferContext();
 }
 
@@ -118,9 +121,29 @@ CommandBufferAccessContext::~CommandBufferAccessContext() {
     sync_state_->stats.RemoveHandleRecord((uint32_t)handles_.size());
 }
 
+// shared_ptr::use_count() is a relaxed load. The fence makes what the other owners did before letting go visible.
+template <typename T>
+static bool IsOnlyOwner(const std::shared_ptr<T> &ptr) {
+    if (ptr.use_count() != 1) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+}
+
 void CommandBufferAccessContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
-    cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    // The log and the references are shared with the submitted batches, they can be reused only when nothing else holds them.
+    // The log stays on the heap: the batches keep it until none of its tags are referenced, which would pin the arena.
+    if (IsOnlyOwner(access_log_)) {
+        access_log_->clear();
+    } else {
+        const size_t previous_size = access_log_->size();
+        access_log_ = std::make_shared<AccessLog>();
+        access_log_->reserve(previous_size);
+    }
+    if (IsOnlyOwner(cbs_referenced_)) {
+        cbs_referenced_->clear();
+    } else {
+        cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    }
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
@@ -130,15 +153,29 @@ void CommandBufferAccessContext::Reset() {
     reset_count_++;
 
     sync_state_->stats.RemoveHandleRecord((uint32_t)handles_.size());
-    handles_.clear();
+    handles_ = HandleRecords();
 
     current_command_tag_ = vvl::kNoIndex32;
-    cb_access_context_.Reset();
     render_pass_contexts_.clear();
-    current_context_ = &cb_access_context_;
-    current_renderpass_context_ = nullptr;
+    // The first scopes of the events are snapshots of access contexts which hold the arena, release them before checking it
     events_context_.Clear();
     dynamic_rendering_info_.reset();
+    if (arena_) {
+        // Drop this context's references to the arena, then recycle it if nothing recorded into it is still in use (a map
+        // shared with a queue batch, or a sync op being replayed). Otherwise those keep the old arena alive on their own.
+        cb_access_context_.Reset(ResourceAccessMapAllocator());
+        if (IsOnlyOwner(arena_)) {
+            arena_->Reset();
+        } else {
+            arena_ = std::make_shared<vvl::Arena>();
+        }
+        cb_access_context_.Reset(ResourceAccessMapAllocator(arena_));
+        handles_ = HandleRecords(HandleRecords::allocator_type(arena_));
+    } else {
+        cb_access_context_.Reset();
+    }
+    current_context_ = &cb_access_context_;
+    current_renderpass_context_ = nullptr;
 }
 
 std::string CommandBufferAccessContext::FormatUsage(ResourceUsageTagEx tag_ex) const {
@@ -296,6 +333,15 @@ void CommandBufferAccessContext::RecordEndRendering(const RecordObject &record_o
     dynamic_rendering_info_.reset();
 }
 
+// The descriptor types of the bound sets match the pipeline layout, unless there is a core validation error
+static SyncStageAccessIndex GetShaderAccessIndex(const syncval_state::ShaderAccess &shader_access,
+                                                 VkDescriptorType descriptor_type) {
+    if (descriptor_type == shader_access.descriptor_type) {
+        return shader_access.sync_index;
+    }
+    return GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, *shader_access.variable, shader_access.stage);
+}
+
 bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                    const Location &loc) const {
     bool skip = false;
@@ -314,140 +360,133 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    const auto &sync_pipe = static_cast<const syncval_state::Pipeline &>(*pipe);
+    for (const syncval_state::ShaderAccess &shader_access : sync_pipe.shader_accesses) {
+        if (shader_access.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[shader_access.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(shader_access.binding);
+        const auto descriptor_type = binding->type;
+        const SyncStageAccessIndex sync_index = GetShaderAccessIndex(shader_access, descriptor_type);
+
+        // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
+        // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
+        // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
+        // elements are accessed in the general case.
+        //
+        // This workaround disables validation for the descriptor array case.
+        if (binding->count > 1) {
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
-            // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
-            // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
-            // elements are accessed in the general case.
-            //
-            // This workaround disables validation for the descriptor array case.
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t index = 0; index < binding->count; index++) {
-                const auto *descriptor = binding->GetDescriptor(index);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
+        for (uint32_t index = 0; index < binding->count; index++) {
+            const auto *descriptor = binding->GetDescriptor(index);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    if (descriptor->Invalid()) {
+                        continue;
+                    }
 
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    VkImageLayout image_layout = image_descriptor->GetImageLayout();
+
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
+                    }
 
-                        HazardResult hazard;
+                    HazardResult hazard;
 
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard =
-                                current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_view_state, sync_index);
-                        }
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        // Input attachments are subject to raster ordering rules
+                        hazard =
+                            current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
+                    } else {
+                        hazard = current_context_->DetectHazard(*img_view_state, sync_index);
+                    }
 
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
-                                "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
-                        }
-                        break;
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
+                            "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
+                            ", index %" PRIu32 ". Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
+                            shader_access.binding, index, FormatHazard(hazard).c_str());
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
-                        }
-                        break;
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), shader_access.binding, index,
+                            FormatHazard(hazard).c_str());
+                    }
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index =
+                            descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
+                    }
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range =
+                        MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), shader_access.binding, index,
+                            FormatHazard(hazard).c_str());
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
@@ -472,95 +511,88 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    const auto &sync_pipe = static_cast<const syncval_state::Pipeline &>(*pipe);
+    for (const syncval_state::ShaderAccess &shader_access : sync_pipe.shader_accesses) {
+        if (shader_access.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[shader_access.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(shader_access.binding);
+        const auto descriptor_type = binding->type;
+        const SyncStageAccessIndex sync_index = GetShaderAccessIndex(shader_access, descriptor_type);
+
+        // Do not update state for descriptor array (the same as in Validate function).
+        if (binding->count > 1) {
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Do not update state for descriptor array (the same as in Validate function).
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t i = 0; i < binding->count; i++) {
-                const auto *descriptor = binding->GetDescriptor(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
-                                                                tag);
-                        } else {
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
-                        }
-                        AddCommandHandle(tag, img_view_state->Handle());
-                        break;
+        for (uint32_t i = 0; i < binding->count; i++) {
+            const auto *descriptor = binding->GetDescriptor(i);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    if (image_descriptor->Invalid()) {
+                        continue;
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
+                                                            tag);
+                    } else {
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
+                    }
+                    AddCommandHandle(tag, img_view_state->Handle());
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
+                    }
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
+                    current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index =
+                            descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
+                    current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
@@ -1125,7 +1157,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.Intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -1263,6 +1295,41 @@ std::string SyncValidationInfo::FormatHazard(const HazardResult &hazard) const {
     return out.str();
 }
 
+std::vector<syncval_state::ShaderAccess> syncval_state::Pipeline::BuildShaderAccesses(const vvl::Pipeline &pipe) {
+    std::vector<ShaderAccess> shader_accesses;
+    const auto layout = pipe.PipelineLayoutState();
+    for (const auto &stage_state : pipe.stage_states) {
+        const VkShaderStageFlagBits stage = stage_state.GetStage();
+        if (stage == VK_SHADER_STAGE_FRAGMENT_BIT && pipe.RasterizationDisabled()) {
+            continue;
+        } else if (!stage_state.entrypoint) {
+            continue;
+        }
+        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
+            // Not accessed whatever the descriptor type is
+            if (!variable.IsAccessed()) {
+                continue;
+            }
+            ShaderAccess shader_access;
+            shader_access.set = variable.decorations.set;
+            shader_access.binding = variable.decorations.binding;
+            shader_access.descriptor_type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+            shader_access.sync_index = SYNC_ACCESS_INDEX_NONE;
+            shader_access.stage = stage;
+            shader_access.variable = &variable;
+
+            const auto dsl = layout ? layout->GetDsl(shader_access.set) : nullptr;
+            const auto *layout_binding = dsl ? dsl->GetDescriptorSetLayoutBindingPtrFromBinding(shader_access.binding) : nullptr;
+            if (layout_binding) {
+                shader_access.descriptor_type = layout_binding->descriptorType;
+                shader_access.sync_index = GetSyncStageAccessIndexsByDescriptorSet(layout_binding->descriptorType, variable, stage);
+            }
+            shader_accesses.emplace_back(shader_access);
+        }
+    }
+    return shader_accesses;
+}
+
 syncval_state::CommandBuffer::CommandBuffer(SyncValidator &dev, VkCommandBuffer handle,
                                             const VkCommandBufferAllocateInfo *allocate_info, const vvl::CommandPool *pool)
     : vvl::CommandBuffer(dev, handle, allocate_info, pool), access_context(dev, this) {}
@@ -103,6 +103,8 @@ struct HandleRecord {
     FormatterState Formatter(const SyncValidator &sync_state) const { return FormatterState(sync_state, *this); }
 };
 
+using HandleRecords = std::vector<HandleRecord, vvl::ArenaAllocator<HandleRecord>>;
+
 struct ResourceCmdUsageRecord {
     static constexpr auto kMaxIndex = std::numeric_limits<ResourceUsageTag>::max();
     enum class SubcommandType { kNone, kSubpassTransition, kLoadOp, kStoreOp, kResolveOp, kIndex };
@@ -331,7 +333,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // The following method allows to set subcommand handles independently of the main command.
     void AddSubcommandHandle(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle, uint32_t index = vvl::kNoIndex32);
 
-    const std::vector<HandleRecord> &GetHandleRecords() const { return handles_; }
+    const HandleRecords &GetHandleRecords() const { return handles_; }
 
     std::shared_ptr<const vvl::CommandBuffer> GetCBStateShared() const { return cb_state_->shared_from_this(); }
 
@@ -343,7 +345,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     template <class T, class... Args>
     void RecordSyncOp(Args &&...args) {
         // T must be as derived from SyncOpBase or the compiler will flag the next line as an error.
-        SyncOpPointer sync_op(std::make_shared<T>(std::forward<Args>(args)...));
+        SyncOpPointer sync_op = arena_ ? std::allocate_shared<T>(vvl::ArenaAllocator<T>(arena_), std::forward<Args>(args)...)
+                                       : std::make_shared<T>(std::forward<Args>(args)...);
         RecordSyncOp(std::move(sync_op));  // Call the non-template version
     }
     std::shared_ptr<AccessLog> GetAccessLogShared() const { return access_log_; }
@@ -380,8 +383,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     uint32_t subcommand_number_;
     uint32_t reset_count_;
 
-    // Handles referenced by the tagged commands
-    std::vector<HandleRecord> handles_;
+    // Handles referenced by the tagged commands, allocated from the arena
+    HandleRecords handles_;
 
     // Location of the current command in the access log (it's not always the last element, there might be
     // subcommands that follow). The subcommands by default reference the same handles as the main command.
@@ -396,6 +399,10 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
 
+    // Backs the access maps, the sync ops and the handle records of the recording. Their memory is reused by the next recording
+    // once Reset finds nothing else referencing the arena, instead of going back to the heap. Null for a proxy context.
+    std::shared_ptr<vvl::Arena> arena_;
+
     // State during dynamic rendering (dynamic rendering rendering passes must be
     // contained within a single command buffer)
     std::unique_ptr<syncval_state::DynamicRenderingInfo> dynamic_rendering_info_;
@@ -407,6 +414,30 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 };
 
 namespace syncval_state {
+// A descriptor accessed by a shader stage of a pipeline
+struct ShaderAccess {
+    uint32_t set;
+    uint32_t binding;
+    // The type of the binding in the pipeline layout, which sync_index is for. VK_DESCRIPTOR_TYPE_MAX_ENUM if not in the layout
+    VkDescriptorType descriptor_type;
+    SyncStageAccessIndex sync_index;
+    VkShaderStageFlagBits stage;
+    const spirv::ResourceInterfaceVariable *variable;
+};
+
+class Pipeline : public vvl::Pipeline {
+  public:
+    template <typename CreateInfo, typename... Args>
+    Pipeline(const ValidationStateTracker &state_data, const CreateInfo *create_info, Args &&...args)
+        : vvl::Pipeline(state_data, create_info, std::forward<Args>(args)...), shader_accesses(BuildShaderAccesses(*this)) {}
+
+    // The descriptor accesses of the stages that execute, worked out once here instead of on every draw and dispatch
+    const std::vector<ShaderAccess> shader_accesses;
+
+  private:
+    static std::vector<ShaderAccess> BuildShaderAccesses(const vvl::Pipeline &pipe);
+};
+
 class CommandBuffer : public vvl::CommandBuffer {
   public:
     CommandBufferAccessContext access_context;
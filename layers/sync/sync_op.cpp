@@ -316,6 +316,7 @@ struct SyncOpPipelineBarrierFunctorFactory {
 template <typename Barriers, typename FunctorFactory>
 void SyncOpBarriers::ApplyBarriers(const Barriers &barriers, const FunctorFactory &factory, const QueueId queue_id,
                                    const ResourceUsageTag tag, AccessContext *access_context) {
+    syncval_stats::access_stats.AddBarrierApplications(static_cast<uint32_t>(barriers.size()));
     for (const auto &barrier : barriers) {
         const auto *state = barrier.GetState();
         if (state) {
@@ -329,6 +330,7 @@ void SyncOpBarriers::ApplyBarriers(const Barriers &barriers, const FunctorFactor
 template <typename Barriers, typename FunctorFactory>
 void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const FunctorFactory &factory, const QueueId queue_id,
                                          const ResourceUsageTag tag, AccessContext *access_context) {
+    syncval_stats::access_stats.AddBarrierApplications(static_cast<uint32_t>(barriers.size()));
     auto barriers_functor = factory.MakeGlobalApplyFunctor(barriers.size(), tag);
     for (const auto &barrier : barriers) {
         barriers_functor.EmplaceBack(factory.MakeGlobalBarrierOpFunctor(queue_id, barrier));
@@ -1225,11 +1227,17 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         HazardResult hazard;
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
-        hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                  *exec_context_.GetCurrentAccessContext());
+        const SyncValidator &sync_state = exec_context_.GetSyncState();
+        if (sync_state.syncval_settings.parallel_hazard_detection) {
+            hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
+                                                                      *exec_context_.GetCurrentAccessContext(),
+                                                                      sync_state.hazard_detection_pool);
+        } else {
+            hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
+                                                                      *exec_context_.GetCurrentAccessContext());
+        }
 
         if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
             const auto handle = exec_context_.Handle();
             const VkCommandBuffer recorded_handle = recorded_context_.GetCBState().VkHandle();
             skip |= sync_state.LogError(
@@ -17,7 +17,19 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+
 struct SyncValSettings {
     bool submit_time_validation = true;
     bool shader_accesses_heuristic = false;
+    // Split the first use hazard checks of submitted command buffers over multiple threads
+    bool parallel_hazard_detection = false;
+    // Record command buffers without the device lock, when fine grained locking is enabled
+    bool unlocked_recording = false;
+    // Collect runtime stats and print them at device destruction
+    bool stats = false;
+    // Collect runtime stats and write them as JSON to this file every stats_interval milliseconds (0: at device destruction)
+    std::string stats_file;
+    uint32_t stats_interval = 1000;
 };
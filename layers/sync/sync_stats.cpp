@@ -17,18 +17,25 @@
 
 #include "sync_stats.h"
 
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 #include "sync_commandbuffer.h"
+#include "sync_settings.h"
+#include "utils/mapped_file.h"
 #include "utils/vk_layer_utils.h"
 
 #include <iostream>
+#include <sstream>
 
 namespace syncval_stats {
 
+AccessStats access_stats;
+thread_local uint32_t ScopedTimer::nesting_ = 0;
+
 void Value32::Update(uint32_t new_value) { u32.store(new_value); }
 uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n); }
 uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n); }
 
+uint64_t Value64::Add(uint64_t n) { return u64.fetch_add(n); }
+
 void ValueMax32::Update(uint32_t new_value) {
     value.Update(new_value);
     vvl::atomic_fetch_max(max_value.u32, new_value);
@@ -44,18 +51,90 @@ void ValueMax32::Sub(uint32_t n) {
     vvl::atomic_fetch_max(max_value.u32, new_value);
 }
 
+void ScopedTimer::Start(Value64 &counter, Value64 &time_ns) {
+    active_ = true;
+    if (nesting_++ == 0) {
+        counter.Add(1);
+        time_ns_ = &time_ns;
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+void ScopedTimer::Stop() {
+    --nesting_;
+    if (time_ns_) {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        time_ns_->Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+}
+
+static double ToSeconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+static double NanosecondsToMilliseconds(uint64_t ns) { return static_cast<double>(ns) / 1000000.0; }
+
 Stats::~Stats() {
     if (report_on_destruction) {
         const std::string report = CreateReport();
         std::cout << report;
     }
+    if (!json_path_.empty()) {
+        std::unique_lock<std::mutex> guard(json_lock_);
+        WriteJsonReport();
+    }
+}
+
+void Stats::Enable(const SyncValSettings &settings) {
+    enabled = true;
+    access_stats.enabled.store(true);
+    start_time_ = std::chrono::steady_clock::now();
+    last_json_time_ = start_time_;
+    json_path_ = settings.stats_file;
+    json_interval_ = std::chrono::milliseconds(settings.stats_interval);
+}
+
+void Stats::AddCommandBufferContext() {
+    if (enabled) command_buffer_context_counter.Add(1);
+}
+void Stats::RemoveCommandBufferContext() {
+    if (enabled) command_buffer_context_counter.Sub(1);
+}
+
+void Stats::AddHandleRecord(uint32_t count) {
+    if (enabled) handle_record_counter.Add(count);
+}
+void Stats::RemoveHandleRecord(uint32_t count) {
+    if (enabled) handle_record_counter.Sub(count);
 }
 
-void Stats::AddCommandBufferContext() { command_buffer_context_counter.Add(1); }
-void Stats::RemoveCommandBufferContext() { command_buffer_context_counter.Sub(1); }
+void Stats::OnBatchTrimStep(uint32_t visited_count, uint32_t merged_count) {
+    if (!enabled) return;
+    batch_trim_step_counter.Add(1);
+    batch_trim_visited_counter.Add(visited_count);
+    batch_trim_merged_counter.Add(merged_count);
+}
+
+void Stats::OnBatchLogTrim(uint32_t trimmed_count) {
+    if (!enabled) return;
+    batch_log_trim_counter.Add(1);
+    batch_log_trimmed_counter.Add(trimmed_count);
+}
+
+void Stats::UpdateBatchSize(uint32_t access_entry_count, uint32_t log_entry_count) {
+    if (!enabled) return;
+    batch_access_entries.Update(access_entry_count);
+    batch_log_entries.Update(log_entry_count);
+}
 
-void Stats::AddHandleRecord(uint32_t count) { handle_record_counter.Add(count); }
-void Stats::RemoveHandleRecord(uint32_t count) { handle_record_counter.Sub(count); }
+void Stats::OnQueueOperation() {
+    if (json_path_.empty() || json_interval_.count() == 0) return;
+    // Submits from other queues don't need to wait for a report that is already being written
+    std::unique_lock<std::mutex> guard(json_lock_, std::try_to_lock);
+    if (guard.owns_lock() && std::chrono::steady_clock::now() - last_json_time_ >= json_interval_) {
+        WriteJsonReport();
+    }
+}
 
 void Stats::ReportOnDestruction() { report_on_destruction = true; }
 
@@ -81,8 +160,84 @@ std::string Stats::CreateReport() {
         str << "\tmax_count = " << handle_record_max << '\n';
         str << "\tmax_memory = " << handle_record_max_memory << " bytes\n";
     }
+    {
+        str << "ResourceAccessState:\n";
+        str << "\tsize = " << sizeof(ResourceAccessState) << " bytes\n";
+        str << "\tmap_entry_size = " << sizeof(ResourceAccessRangeMap::value_type) << " bytes\n";
+    }
+    {
+        str << "QueueBatchContext trimming:\n";
+        str << "\tsteps = " << batch_trim_step_counter.u64 << '\n';
+        str << "\tvisited_entries = " << batch_trim_visited_counter.u64 << '\n';
+        str << "\tmerged_entries = " << batch_trim_merged_counter.u64 << '\n';
+        str << "\tlog_trims = " << batch_log_trim_counter.u64 << '\n';
+        str << "\ttrimmed_log_entries = " << batch_log_trimmed_counter.u64 << '\n';
+        str << "\taccess_entries = " << batch_access_entries.value.u32 << '\n';
+        str << "\tmax_access_entries = " << batch_access_entries.max_value.u32 << '\n';
+        str << "\tlog_entries = " << batch_log_entries.value.u32 << '\n';
+        str << "\tmax_log_entries = " << batch_log_entries.max_value.u32 << '\n';
+    }
+    {
+        const double seconds = ToSeconds(std::chrono::steady_clock::now() - start_time_);
+        const uint64_t hazard_checks = access_stats.hazard_check_counter.u64;
+        const uint64_t access_updates = access_stats.access_update_counter.u64;
+
+        str << "AccessContext (all devices):\n";
+        str << "\thazard_checks = " << hazard_checks << '\n';
+        str << "\thazard_checks_per_second = " << (seconds > 0.0 ? hazard_checks / seconds : 0.0) << '\n';
+        str << "\tdetect_hazard_time = " << NanosecondsToMilliseconds(access_stats.detect_hazard_ns.u64) << " ms\n";
+        str << "\taccess_updates = " << access_updates << '\n';
+        str << "\taccess_updates_per_second = " << (seconds > 0.0 ? access_updates / seconds : 0.0) << '\n';
+        str << "\tupdate_access_state_time = " << NanosecondsToMilliseconds(access_stats.update_access_state_ns.u64) << " ms\n";
+        str << "\tbarrier_applications = " << access_stats.barrier_application_counter.u64 << '\n';
+    }
+    return str.str();
+}
+
+std::string Stats::CreateJsonReport() {
+    const auto now = std::chrono::steady_clock::now();
+    const double interval_seconds = ToSeconds(now - last_json_time_);
+    const uint64_t hazard_checks = access_stats.hazard_check_counter.u64;
+    const uint64_t access_updates = access_stats.access_update_counter.u64;
+    // Rates are over the interval since the previous report, so that changes in the workload show up
+    auto per_second = [interval_seconds](uint64_t count) { return interval_seconds > 0.0 ? count / interval_seconds : 0.0; };
+
+    std::ostringstream str;
+    str << "{\n";
+    str << "  \"elapsed_seconds\": " << ToSeconds(now - start_time_) << ",\n";
+    str << "  \"command_buffer_contexts\": {\"count\": " << command_buffer_context_counter.value.u32
+        << ", \"max_count\": " << command_buffer_context_counter.max_value.u32 << "},\n";
+    str << "  \"handle_records\": {\"count\": " << handle_record_counter.value.u32
+        << ", \"max_count\": " << handle_record_counter.max_value.u32 << ", \"bytes\": "
+        << uint64_t(handle_record_counter.value.u32) * sizeof(HandleRecord) << "},\n";
+    str << "  \"resource_access_state\": {\"bytes\": " << sizeof(ResourceAccessState)
+        << ", \"map_entry_bytes\": " << sizeof(ResourceAccessRangeMap::value_type) << "},\n";
+    str << "  \"queue_batches\": {\"access_entries\": " << batch_access_entries.value.u32
+        << ", \"max_access_entries\": " << batch_access_entries.max_value.u32
+        << ", \"access_bytes\": " << uint64_t(batch_access_entries.value.u32) * sizeof(ResourceAccessRangeMap::value_type)
+        << ", \"log_entries\": " << batch_log_entries.value.u32 << ", \"max_log_entries\": " << batch_log_entries.max_value.u32
+        << ", \"trim_steps\": " << batch_trim_step_counter.u64 << ", \"trim_visited_entries\": " << batch_trim_visited_counter.u64
+        << ", \"trim_merged_entries\": " << batch_trim_merged_counter.u64 << ", \"log_trims\": " << batch_log_trim_counter.u64
+        << ", \"trimmed_log_entries\": " << batch_log_trimmed_counter.u64 << "},\n";
+    str << "  \"hazard_detection\": {\"count\": " << hazard_checks
+        << ", \"per_second\": " << per_second(hazard_checks - last_json_hazard_checks_)
+        << ", \"time_ms\": " << NanosecondsToMilliseconds(access_stats.detect_hazard_ns.u64) << "},\n";
+    str << "  \"access_updates\": {\"count\": " << access_updates
+        << ", \"per_second\": " << per_second(access_updates - last_json_access_updates_)
+        << ", \"time_ms\": " << NanosecondsToMilliseconds(access_stats.update_access_state_ns.u64) << "},\n";
+    str << "  \"barrier_applications\": " << access_stats.barrier_application_counter.u64 << "\n";
+    str << "}\n";
+
+    last_json_time_ = now;
+    last_json_hazard_checks_ = hazard_checks;
+    last_json_access_updates_ = access_updates;
     return str.str();
 }
 
+void Stats::WriteJsonReport() {
+    // Readers polling the file never see a partially written report
+    const std::string report = CreateJsonReport();
+    vvl::WriteFileAtomic(json_path_.c_str(), report.data(), report.size());
+}
+
 }  // namespace syncval_stats
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
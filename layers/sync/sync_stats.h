@@ -17,27 +17,30 @@
 
 #pragma once
 
-#include <string>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <mutex>
+#include <string>
 
-#ifndef VVL_ENABLE_SYNCVAL_STATS
-#define VVL_ENABLE_SYNCVAL_STATS 0
-#endif
-
-#if VVL_ENABLE_SYNCVAL_STATS != 0
-#include <atomic>
-#endif
+struct SyncValSettings;
 
+// SyncVal stats are always built, but only collected when enabled at device creation (syncval_stats setting or
+// VK_SYNCVAL_SHOW_STATS environment variable). When disabled, each update is a single predictable branch.
 namespace syncval_stats {
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 
 struct Value32 {
-    std::atomic_uint32_t u32;
+    std::atomic_uint32_t u32{0};
     void Update(uint32_t new_value);
     uint32_t Add(uint32_t n);
     uint32_t Sub(uint32_t n);
 };
 
+struct Value64 {
+    std::atomic_uint64_t u64{0};
+    uint64_t Add(uint64_t n);
+};
+
 struct ValueMax32 {
     Value32 value;
     Value32 max_value;
@@ -46,8 +49,60 @@ struct ValueMax32 {
     void Sub(uint32_t n);
 };
 
+// Counters of the access context operations. AccessContext and the sync ops have no way back to their SyncValidator,
+// so these are process wide, shared by the stats of all devices, and collected once any device enables stats.
+struct AccessStats {
+    std::atomic_bool enabled{false};
+
+    Value64 hazard_check_counter;
+    Value64 detect_hazard_ns;
+    Value64 access_update_counter;
+    Value64 update_access_state_ns;
+    Value64 barrier_application_counter;
+
+    bool Enabled() const { return enabled.load(std::memory_order_relaxed); }
+    void AddBarrierApplications(uint32_t count) {
+        if (Enabled()) barrier_application_counter.Add(count);
+    }
+};
+extern AccessStats access_stats;
+
+// Counts one operation and adds the time spent in its scope, when stats are enabled.
+// Only the outermost timer of a thread counts, so operations calling into each other are not counted twice.
+class ScopedTimer {
+  public:
+    ScopedTimer(Value64 &counter, Value64 &time_ns) {
+        if (access_stats.Enabled()) {
+            Start(counter, time_ns);
+        }
+    }
+    ~ScopedTimer() {
+        if (active_) {
+            Stop();
+        }
+    }
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+  private:
+    void Start(Value64 &counter, Value64 &time_ns);
+    void Stop();
+
+    bool active_ = false;
+    Value64 *time_ns_ = nullptr;  // null for nested timers
+    std::chrono::steady_clock::time_point start_;
+    static thread_local uint32_t nesting_;
+};
+
+inline ScopedTimer TimeDetectHazard() { return ScopedTimer(access_stats.hazard_check_counter, access_stats.detect_hazard_ns); }
+inline ScopedTimer TimeUpdateAccessState() {
+    return ScopedTimer(access_stats.access_update_counter, access_stats.update_access_state_ns);
+}
+
 struct Stats {
     ~Stats();
+    void Enable(const SyncValSettings &settings);
+    bool enabled = false;
     bool report_on_destruction = false;
 
     ValueMax32 command_buffer_context_counter;
@@ -58,18 +113,37 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    // Incremental trimming of the last batch of each queue, done on every submit
+    Value64 batch_trim_step_counter;
+    Value64 batch_trim_visited_counter;
+    Value64 batch_trim_merged_counter;
+    Value64 batch_log_trim_counter;
+    Value64 batch_log_trimmed_counter;
+    ValueMax32 batch_access_entries;
+    ValueMax32 batch_log_entries;
+    void OnBatchTrimStep(uint32_t visited_count, uint32_t merged_count);
+    void OnBatchLogTrim(uint32_t trimmed_count);
+    void UpdateBatchSize(uint32_t access_entry_count, uint32_t log_entry_count);
+
+    // Called on every submit and present, writes the JSON report when it is due
+    void OnQueueOperation();
+
     void ReportOnDestruction();
     std::string CreateReport();
-};
 
-#else
-struct Stats {
-    void AddHandleRecord(uint32_t count = 1) {}
-    void RemoveHandleRecord(uint32_t count = 1) {}
-    void AddCommandBufferContext() {}
-    void RemoveCommandBufferContext() {}
-    void ReportOnDestruction() {}
-    std::string CreateReport() { return "SyncVal stats are disabled in the current build configuration\n"; }
+  private:
+    // json_lock_ must be held
+    std::string CreateJsonReport();
+    void WriteJsonReport();
+
+    std::string json_path_;
+    std::chrono::steady_clock::duration json_interval_{};
+    std::chrono::steady_clock::time_point start_time_;
+
+    std::mutex json_lock_;
+    std::chrono::steady_clock::time_point last_json_time_;
+    uint64_t last_json_hazard_checks_ = 0;
+    uint64_t last_json_access_updates_ = 0;
 };
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
+
 }  // namespace syncval_stats
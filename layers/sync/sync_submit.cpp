@@ -19,6 +19,9 @@
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
 
+#include <algorithm>
+#include <utility>
+
 AcquiredImage::AcquiredImage(const PresentedImage& presented, ResourceUsageTag acq_tag)
     : image(presented.image), generator(presented.range_gen), present_tag(presented.tag), acquire_tag(acq_tag) {}
 
@@ -192,6 +195,37 @@ void QueueBatchContext::Trim() {
     batch_log_.Trim(used_tags);
 }
 
+// Full trims of the last batch on every submit cost time proportional to all the accesses still tracked on the queue, so
+// each submit only does a bounded step of the work instead. The step size grows with the access map, so that a full pass
+// over the map (and with it a trim of the batch log) happens at least every kTrimStepsPerPass submits.
+static constexpr uint32_t kMinTrimStepEntries = 256;
+static constexpr uint32_t kTrimStepsPerPass = 8;
+// Below this size, the batch log isn't trimmed in between full passes
+static constexpr size_t kMinLogTrimSize = 64;
+
+void QueueBatchContext::TrimIncremental(QueueBatchTrimState& trim_state) {
+    const size_t entries_before = std::as_const(access_context_).GetAccessStateMap().size();
+    const uint32_t entry_budget = std::max(kMinTrimStepEntries, static_cast<uint32_t>(entries_before / kTrimStepsPerPass));
+    const uint32_t visited = access_context_.TrimAndClearFirstAccessIncremental(trim_state.cursor, entry_budget);
+    const size_t entries_after = std::as_const(access_context_).GetAccessStateMap().size();
+    sync_state_->stats.OnBatchTrimStep(visited, static_cast<uint32_t>(entries_before - entries_after));
+
+    // The log can only be trimmed against the tags referenced by the whole batch, so do that at the end of every pass,
+    // or sooner if the log has doubled in size since it was last trimmed
+    const bool pass_done = trim_state.cursor == 0;
+    const size_t log_size = batch_log_.Size();
+    trim_state.trimmed_log_size = std::min(trim_state.trimmed_log_size, log_size);
+    if (pass_done || log_size > std::max(kMinLogTrimSize, 2 * trim_state.trimmed_log_size)) {
+        ResourceUsageTagSet used_tags;
+        access_context_.AddReferencedTags(used_tags);
+        events_context_.AddReferencedTags(used_tags);
+        batch_log_.Trim(used_tags);
+        trim_state.trimmed_log_size = batch_log_.Size();
+        sync_state_->stats.OnBatchLogTrim(static_cast<uint32_t>(log_size - trim_state.trimmed_log_size));
+    }
+    sync_state_->stats.UpdateBatchSize(static_cast<uint32_t>(entries_after), static_cast<uint32_t>(batch_log_.Size()));
+}
+
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
     GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context);
 }
@@ -592,7 +626,7 @@ void QueueSyncState::UpdateLastBatch() {
         if (last_batch_) {
             last_batch_->ResetEventsContext();
         }
-        pending_last_batch_->Trim();
+        pending_last_batch_->TrimIncremental(trim_state_);
         last_batch_ = std::move(pending_last_batch_);
     }
 }
@@ -179,15 +179,25 @@ class BatchAccessLog {
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    size_t Size() const { return log_map_.size(); }
     // AccessRecord lookup is based on global tags
     AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
     BatchAccessLog() {}
 
   private:
-    using CBSubmitLogRangeMap = sparse_container::range_map<ResourceUsageTag, CBSubmitLog>;
+    // Appended to in tag order on each submit, and searched for every hazard reported
+    using CBSubmitLogRangeMap = sparse_container::flat_range_map<ResourceUsageTag, CBSubmitLog>;
     CBSubmitLogRangeMap log_map_;
 };
 
+// Progress of the incremental trimming of a queue's batches, carried over from each last batch of the queue to the next
+struct QueueBatchTrimState {
+    // Where the next trim step continues in the access state map
+    ResourceAddress cursor = 0;
+    // Size of the batch log right after it was last trimmed
+    size_t trimmed_log_size = 0;
+};
+
 class QueueBatchContext : public CommandExecutionContext, public std::enable_shared_from_this<QueueBatchContext> {
   public:
     class PresentResourceRecord : public AlternateResourceUsage::RecordBase {
@@ -230,6 +240,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
     QueueBatchContext(const SyncValidator &sync_state);
     QueueBatchContext() = delete;
     void Trim();
+    void TrimIncremental(QueueBatchTrimState &trim_state);
 
     std::string FormatUsage(ResourceUsageTagEx tag_ex) const override;
     AccessContext *GetCurrentAccessContext() override { return current_access_context_; }
@@ -324,6 +335,7 @@ class QueueSyncState {
 
     mutable QueueBatchContext::Ptr pending_last_batch_;
     QueueBatchContext::Ptr last_batch_;
+    QueueBatchTrimState trim_state_;
 };
 
 struct QueueSubmitCmdState {
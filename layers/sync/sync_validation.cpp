@@ -27,18 +27,6 @@
 #include "state_tracker/buffer_state.h"
 #include "utils/convert_utils.h"
 
-SyncValidator::~SyncValidator() {
-    // Instance level SyncValidator does not have much to say
-    const bool device_validation_object = (device != nullptr);
-    // Get environment variable. Specify non-zero number to enable
-    const auto show_stats_str = GetEnvironment("VK_SYNCVAL_SHOW_STATS");
-    const bool show_stats = !show_stats_str.empty() && std::stoul(show_stats_str) != 0;
-
-    if (device_validation_object && show_stats) {
-        stats.ReportOnDestruction();
-    }
-}
-
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
     reserve.begin = tag_limit_.fetch_add(tag_count);
@@ -46,6 +34,29 @@ ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const
     return reserve;
 }
 
+// With syncval_unlocked_recording, vkCmd* calls don't take the device lock. They write only:
+// - the access context, access log, events and render pass state of the command buffer being recorded, which the application
+//   synchronizes externally, and which the device only reads at submission, when the command buffer can't be recorded.
+// - the global tag counter (atomic) and the stats (atomics, or their own lock for the JSON output).
+// The device state they read is immutable while the command buffer is recorded (resource create info and bindings, since
+// destroying or rebinding a resource in use is invalid), or internally synchronized (the state object maps and the settings).
+// This is opt-in, as a state object shared with the device, added without this in mind, would silently race.
+ReadLockGuard SyncValidator::CommandBufferReadLock() const {
+    if (global_settings.fine_grained_locking && syncval_settings.unlocked_recording) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLockGuard(validation_object_mutex);
+    }
+}
+
+WriteLockGuard SyncValidator::CommandBufferWriteLock() {
+    if (global_settings.fine_grained_locking && syncval_settings.unlocked_recording) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLockGuard(validation_object_mutex);
+    }
+}
+
 void SyncValidator::UpdateSignaledSemaphores(SignaledSemaphoresUpdate &update, const QueueBatchContext::Ptr &last_batch) {
     // NOTE: All conserved QueueBatchContexts need to have their access logs reset to use the global
     // logger and the only conserved QBCs are those referenced by unwaited signals and the last batch.
@@ -204,6 +215,37 @@ std::shared_ptr<vvl::ImageView> SyncValidator::CreateImageViewState(
     return std::make_shared<ImageViewState>(image_state, handle, create_info, format_features, cubic_props);
 }
 
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateGraphicsPipelineState(
+    const VkGraphicsPipelineCreateInfo *create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+    std::shared_ptr<const vvl::RenderPass> &&render_pass, std::shared_ptr<const vvl::PipelineLayout> &&layout,
+    spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages]) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, create_info, std::move(pipeline_cache), std::move(render_pass),
+                                                     std::move(layout), stateless_data);
+}
+
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateComputePipelineState(const VkComputePipelineCreateInfo *create_info,
+                                                                         std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                                         std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                                         spirv::StatelessData *stateless_data) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, create_info, std::move(pipeline_cache), std::move(layout),
+                                                     stateless_data);
+}
+
+// Ray tracing shader accesses are not validated yet, but every pipeline is a syncval_state::Pipeline
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateRayTracingPipelineState(
+    const VkRayTracingPipelineCreateInfoNV *create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+    std::shared_ptr<const vvl::PipelineLayout> &&layout, spirv::StatelessData *stateless_data) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, create_info, std::move(pipeline_cache), std::move(layout),
+                                                     stateless_data);
+}
+
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateRayTracingPipelineState(
+    const VkRayTracingPipelineCreateInfoKHR *create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+    std::shared_ptr<const vvl::PipelineLayout> &&layout, spirv::StatelessData *stateless_data) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, create_info, std::move(pipeline_cache), std::move(layout),
+                                                     stateless_data);
+}
+
 bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                  uint32_t regionCount, const VkBufferCopy *pRegions,
                                                  const ErrorObject &error_obj) const {
@@ -637,6 +679,16 @@ void SyncValidator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, cons
     }
     debug_cmdbuf_pattern = GetEnvironment("VK_SYNCVAL_DEBUG_CMDBUF_PATTERN");
     vvl::ToLower(debug_cmdbuf_pattern);
+
+    // Specify non-zero number to print stats at device destruction, same as the syncval_stats setting
+    const auto show_stats_str = GetEnvironment("VK_SYNCVAL_SHOW_STATS");
+    const bool show_stats = syncval_settings.stats || (!show_stats_str.empty() && std::stoul(show_stats_str) != 0);
+    if (show_stats || !syncval_settings.stats_file.empty()) {
+        stats.Enable(syncval_settings);
+    }
+    if (show_stats) {
+        stats.ReportOnDestruction();
+    }
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -2983,6 +3035,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
         presented.ExportToSwapchain(*this);
     }
     queue_state->UpdateLastBatch();
+    stats.OnQueueOperation();
 }
 
 void SyncValidator::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
@@ -3127,6 +3180,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
 
     ResourceUsageRange fence_tag_range = ReserveGlobalTagRange(1U);
     UpdateFenceWaitInfo(fence, queue_state->GetQueueId(), fence_tag_range.begin);
+    stats.OnQueueOperation();
 }
 
 bool SyncValidator::PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
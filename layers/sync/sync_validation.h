@@ -28,13 +28,15 @@
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_stats.h"
 #include "sync/sync_submit.h"
+#include "utils/thread_pool.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, vvl::CommandBuffer)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, syncval_state::Swapchain, vvl::Swapchain)
+VALSTATETRACK_DERIVED_STATE_OBJECT(VkPipeline, syncval_state::Pipeline, vvl::Pipeline)
 
-class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
+class SyncValidator final : public ValidationStateTracker, public SyncStageAccess {
   public:
     using ImageState = syncval_state::ImageState;
     using ImageViewState = syncval_state::ImageViewState;
@@ -44,18 +46,23 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using Field = vvl::Field;
 
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
-    ~SyncValidator();
 
     // Stats object must be the first member of this class:
     // - it is the first to be constructed: can observe all subsequent syncval stats events
     // - it is the last to be destroyed: ensures there are no unreported syncval stats events.
     mutable syncval_stats::Stats stats;  // Stats object is thread safe
 
+    // Splits the first use hazard checks of submitted command buffers over multiple threads (parallel_hazard_detection)
+    mutable vvl::ThreadPool hazard_detection_pool{0};
+
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
     mutable std::atomic<ResourceUsageTag> tag_limit_{1};  // This is reserved in Validation phase, thus mutable and atomic
     ResourceUsageRange ReserveGlobalTagRange(size_t tag_count) const;  // Note that the tag_limit_ is mutable this has side effects
 
+    ReadLockGuard CommandBufferReadLock() const override;
+    WriteLockGuard CommandBufferWriteLock() override;
+
     std::vector<std::shared_ptr<QueueSyncState>> queue_sync_states_;
     QueueId queue_id_limit_ = 0;
 
@@ -107,6 +114,22 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                                          const VkImageViewCreateInfo *create_info,
                                                          VkFormatFeatureFlags2 format_features,
                                                          const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) final;
+    std::shared_ptr<vvl::Pipeline> CreateGraphicsPipelineState(
+        const VkGraphicsPipelineCreateInfo *create_info, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+        std::shared_ptr<const vvl::RenderPass> &&render_pass, std::shared_ptr<const vvl::PipelineLayout> &&layout,
+        spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages]) const final;
+    std::shared_ptr<vvl::Pipeline> CreateComputePipelineState(const VkComputePipelineCreateInfo *create_info,
+                                                              std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                              std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                              spirv::StatelessData *stateless_data) const final;
+    std::shared_ptr<vvl::Pipeline> CreateRayTracingPipelineState(const VkRayTracingPipelineCreateInfoNV *create_info,
+                                                                 std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                                 std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                                 spirv::StatelessData *stateless_data) const final;
+    std::shared_ptr<vvl::Pipeline> CreateRayTracingPipelineState(const VkRayTracingPipelineCreateInfoKHR *create_info,
+                                                                 std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                                 std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                                 spirv::StatelessData *stateless_data) const final;
 
     void RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                   const VkSubpassBeginInfo *pSubpassBeginInfo, Func command);
@@ -19,6 +19,33 @@
 #include "generated/layer_chassis_dispatch.h"  // wrap_handles declaration
 #include "thread_tracker/thread_safety_validation.h"
 
+#include "utils/epoch_reclaimer.h"
+
+static vvl::EpochReclaimer &GetEpochReclaimer() {
+    // Never destroyed, threads can still exit (and release their slot) after the static destructors ran
+    static auto *reclaimer = new vvl::EpochReclaimer();
+    return *reclaimer;
+}
+
+ObjectUseTokens &ObjectUseTokens::Current() {
+    thread_local ObjectUseTokens tokens;
+    return tokens;
+}
+
+ObjectUseTokens::ObjectUseTokens() : slot_(GetEpochReclaimer().AcquireSlot()) { tokens_.reserve(32); }
+
+ObjectUseTokens::~ObjectUseTokens() { GetEpochReclaimer().ReleaseSlot(slot_); }
+
+std::atomic<uint32_t> ObjectUseTokens::sample_window_{0};
+
+// The counters are locked maps, and the wrapped handle attachments are sequentially consistent, so a thread finding an
+// object has this ordered before the object's removal
+void ObjectUseTokens::AnnounceEpoch() { GetEpochReclaimer().Enter(slot_); }
+
+void ObjectUseTokens::AnnounceIdle() { GetEpochReclaimer().Leave(slot_); }
+
+void ObjectUseTokens::Retire(ObjectUseData *use_data) { GetEpochReclaimer().Retire(use_data); }
+
 ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
@@ -702,12 +729,6 @@ void ThreadSafety::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, V
                                                               const VkRayTracingPipelineCreateInfoKHR* pCreateInfos,
                                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                               const RecordObject& record_obj) {
-    auto unlock_objects = [this, device, deferredOperation, pipelineCache, record_obj]() {
-        this->FinishReadObjectParentInstance(device, record_obj.location);
-        this->FinishReadObject(deferredOperation, record_obj.location);
-        this->FinishReadObject(pipelineCache, record_obj.location);
-    };
-
     auto register_objects = [this](const std::vector<VkPipeline>& pipelines) {
         for (auto pipe : pipelines) {
             if (!pipe) continue;
@@ -719,6 +740,17 @@ void ThreadSafety::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, V
     // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/5817
     const bool is_operation_deferred = (deferredOperation != VK_NULL_HANDLE && record_obj.result == VK_OPERATION_DEFERRED_KHR);
     if (is_operation_deferred) {
+        // The uses end on the thread completing the operation, and must not keep this thread's critical section open until then
+        const bool unlock_device = DetachObjectParentInstance(device);
+        const bool unlock_deferred_operation = DetachObject(deferredOperation);
+        const bool unlock_pipeline_cache = DetachObject(pipelineCache);
+        auto unlock_objects = [this, device, deferredOperation, pipelineCache, record_obj, unlock_device, unlock_deferred_operation,
+                               unlock_pipeline_cache]() {
+            if (unlock_device) this->FinishDetachedReadObjectParentInstance(device, record_obj.location);
+            if (unlock_deferred_operation) this->FinishDetachedReadObject(deferredOperation, record_obj.location);
+            if (unlock_pipeline_cache) this->FinishDetachedReadObject(pipelineCache, record_obj.location);
+        };
+
         auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
         if (wrap_handles) {
             deferredOperation = layer_data->Unwrap(deferredOperation);
@@ -742,7 +774,9 @@ void ThreadSafety::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, V
         post_check_fns.emplace_back(register_objects);
         layer_data->deferred_operation_post_check.insert(deferredOperation, std::move(post_check_fns));
     } else {
-        unlock_objects();
+        FinishReadObjectParentInstance(device, record_obj.location);
+        FinishReadObject(deferredOperation, record_obj.location);
+        FinishReadObject(pipelineCache, record_obj.location);
         if (pPipelines) {
             for (uint32_t index = 0; index < createInfoCount; index++) {
                 if (!pPipelines[index]) continue;
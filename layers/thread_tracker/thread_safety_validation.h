@@ -20,10 +20,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
+#include "utils/epoch_reclaimer.h"
 #include "utils/vk_layer_utils.h"
 
 VK_DEFINE_NON_DISPATCHABLE_HANDLE(DISTINCT_NONDISPATCHABLE_PHONY_HANDLE)
@@ -96,23 +98,146 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
     std::atomic<int64_t> writer_reader_count{};
 };
 
+// The ObjectUseData a thread is using in its current API call, from the Start*() to the Finish*() of each object, so that
+// Finish*() doesn't have to look the object up again. Uses left untracked by sampling are kept too (without data), so that
+// Finish*() knows to skip them.
+//
+// These are raw pointers, kept valid by epoch based reclamation (vvl::EpochReclaimer). A thread holding any is in a critical
+// section, announced with the global epoch when it started. The ObjectUseData of a destroyed object is retired with the epoch
+// of its removal from the counter, and only freed once no critical section started at or before that epoch is left. So the
+// tokens must not outlive the API call: a use finished by another thread (deferred operations) is detached from them.
+class ObjectUseTokens {
+  public:
+    // The tokens of the calling thread
+    static ObjectUseTokens &Current();
+
+    ObjectUseTokens();
+    ~ObjectUseTokens();
+    ObjectUseTokens(const ObjectUseTokens &) = delete;
+    ObjectUseTokens &operator=(const ObjectUseTokens &) = delete;
+
+    // ObjectUseData found in a counter after Enter() stays valid until the matching Leave()
+    void Enter() {
+        if (depth_++ == 0) {
+            AnnounceEpoch();
+        }
+    }
+    void Leave() {
+        assert(depth_ > 0);
+        if (--depth_ == 0) {
+            AnnounceIdle();
+        }
+    }
+
+    // Keeps use_data (and the Enter() done to find it) until Take() with the same counter and object. use_data is null for an
+    // untracked use, for which there was no Enter().
+    void Push(const void *counter, uint64_t object, ObjectUseData *use_data) { tokens_.push_back({counter, object, use_data}); }
+    // Returns false if there is no token for the object. Otherwise sets use_data, and if not null, Leave() once done with it.
+    bool Take(const void *counter, uint64_t object, ObjectUseData *&use_data) {
+        for (size_t i = tokens_.size(); i-- > 0;) {
+            if (tokens_[i].object == object && tokens_[i].counter == counter) {
+                use_data = tokens_[i].use_data;
+                tokens_[i] = tokens_.back();
+                tokens_.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Frees use_data once no thread can be using it anymore. It must not be reachable from any counter.
+    static void Retire(ObjectUseData *use_data);
+
+    // Whether to track the object use being started, with 1 in sample_rate API calls tracked. The decision is made for the
+    // first use of a call (when the thread holds no token), and holds for all the objects of the call. Calls are sampled in
+    // windows shared by all threads (each thread advancing them as it goes), so calls overlapping in a sampled window are all
+    // tracked, and a race between them is caught as reliably as without sampling.
+    bool Sample(uint32_t sample_rate) {
+        if (sample_rate <= 1) {
+            return true;
+        }
+        if (tokens_.empty()) {
+            if (++sample_calls_ == kSampleWindowCalls) {
+                sample_calls_ = 0;
+                sample_window_.fetch_add(1, std::memory_order_relaxed);
+            }
+            call_sampled_ = sample_window_.load(std::memory_order_relaxed) % sample_rate == 0;
+        }
+        return call_sampled_;
+    }
+
+  private:
+    struct Token {
+        const void *counter;
+        uint64_t object;
+        ObjectUseData *use_data;
+    };
+
+    void AnnounceEpoch();
+    void AnnounceIdle();
+
+    vvl::EpochReclaimer::Slot *slot_;
+    uint32_t depth_ = 0;
+    std::vector<Token> tokens_;
+
+    static constexpr uint32_t kSampleWindowCalls = 256;
+    static std::atomic<uint32_t> sample_window_;
+    uint32_t sample_calls_ = 0;
+    bool call_sampled_ = true;
+};
+
 template <typename T>
 class counter {
   public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    // Owns the ObjectUseData of all objects of the counter
+    vvl::concurrent_unordered_map<T, ObjectUseData *, 6> object_table;
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    // With lock-free handle wrapping, the ObjectUseData of a wrapped handle is also attached to its unique_id_mapping slot,
+    // where FindObject() gets it without hashing or locking. A handle has only one attachment, so only one counter of each
+    // handle may use it, and never a counter of dispatchable handles, which are not wrapped.
+    bool attach_to_wrapped_handles;
+
+    void CreateObject(T object) {
+        auto *use_data = new ObjectUseData();
+        if (!object_table.insert(object, use_data)) {
+            delete use_data;
+            return;
+        }
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+        if (attach_to_wrapped_handles) {
+            unique_id_mapping.attach(HandleToUint64(object), use_data);
+        }
+#endif
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+                // Usually already cleared by the unwrapping of the destroyed handle
+                if (attach_to_wrapped_handles) {
+                    unique_id_mapping.detach(HandleToUint64(object), iter->second);
+                }
+#endif
+                // Other threads may still hold it
+                ObjectUseTokens::Retire(iter->second);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
+    // Must be called between Enter() and Leave() of the thread's ObjectUseTokens
+    ObjectUseData *FindObject(T object, const Location& loc) {
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+        if (attach_to_wrapped_handles) {
+            if (void *attachment = unique_id_mapping.find_attachment(HandleToUint64(object))) {
+                return static_cast<ObjectUseData *>(attachment);
+            }
+        }
+#endif
         assert(object_table.contains(object));
         auto iter = object_table.find(object);
         if (iter != object_table.end()) {
@@ -130,7 +255,7 @@ class counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        ObjectUseData *use_data = BeginUse(object, loc);
         if (!use_data) {
             return;
         }
@@ -168,18 +293,18 @@ class counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
-        if (!use_data) {
-            return;
+        ObjectUseTokens &tokens = ObjectUseTokens::Current();
+        if (ObjectUseData *use_data = EndUse(tokens, object, loc)) {
+            use_data->RemoveWriter();
+            tokens.Leave();
         }
-        use_data->RemoveWriter();
     }
 
     void StartRead(T object, const Location& loc) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        ObjectUseData *use_data = BeginUse(object, loc);
         if (!use_data) {
             return;
         }
@@ -203,19 +328,87 @@ class counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
-        if (!use_data) {
-            return;
+        ObjectUseTokens &tokens = ObjectUseTokens::Current();
+        if (ObjectUseData *use_data = EndUse(tokens, object, loc)) {
+            use_data->RemoveReader();
+            tokens.Leave();
+        }
+    }
+
+    // For a use started by this thread and finished by another one, as the completion of a deferred operation does. Removes
+    // the use from the thread's tokens, and returns whether it is tracked, in which case the other thread must finish it
+    // with FinishDetachedRead().
+    bool DetachUse(T object) {
+        if (object == VK_NULL_HANDLE) {
+            return false;
+        }
+        ObjectUseTokens &tokens = ObjectUseTokens::Current();
+        ObjectUseData *use_data = nullptr;
+        if (!tokens.Take(this, HandleToUint64(object), use_data) || !use_data) {
+            return false;
         }
-        use_data->RemoveReader();
+        tokens.Leave();
+        return true;
     }
 
-    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr) {
+    // Finishes a read detached with DetachUse(), looking the object up again in a critical section of the calling thread
+    void FinishDetachedRead(T object, const Location& loc) {
+        ObjectUseTokens &tokens = ObjectUseTokens::Current();
+        if (ObjectUseData *use_data = LookUpUse(tokens, object, loc)) {
+            use_data->RemoveReader();
+            tokens.Leave();
+        }
+    }
+
+    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr,
+            bool attach_to_wrapped = true) {
         object_type = type;
         object_data = val_obj;
+        attach_to_wrapped_handles = attach_to_wrapped;
+    }
+    ~counter() {
+        for (const auto &entry : object_table.snapshot()) {
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+            if (attach_to_wrapped_handles) {
+                unique_id_mapping.detach(HandleToUint64(entry.first), entry.second);
+            }
+#endif
+            ObjectUseTokens::Retire(entry.second);
+        }
     }
 
   private:
+    // Looks up the object, and keeps it in the thread's tokens for the Finish*() call. Returns null if the use is not tracked.
+    ObjectUseData *BeginUse(T object, const Location& loc) {
+        ObjectUseTokens &tokens = ObjectUseTokens::Current();
+        ObjectUseData *use_data = nullptr;
+        if (tokens.Sample(object_data->global_settings.thread_safety_sample_rate)) {
+            use_data = LookUpUse(tokens, object, loc);
+        }
+        tokens.Push(this, HandleToUint64(object), use_data);
+        return use_data;
+    }
+
+    // The data kept by BeginUse(), null if the use is not tracked. tokens.Leave() must be called when done with it.
+    ObjectUseData *EndUse(ObjectUseTokens &tokens, T object, const Location& loc) {
+        ObjectUseData *use_data = nullptr;
+        if (tokens.Take(this, HandleToUint64(object), use_data)) {
+            return use_data;
+        }
+        // Finish*() without a Start*() on this thread, look the object up as the use can only be assumed to be tracked
+        return LookUpUse(tokens, object, loc);
+    }
+
+    // Finds the object in a new critical section of the thread. tokens.Leave() must be called when done with it.
+    ObjectUseData *LookUpUse(ObjectUseTokens &tokens, T object, const Location& loc) {
+        tokens.Enter();
+        ObjectUseData *use_data = FindObject(object, loc);
+        if (!use_data) {
+            tokens.Leave();
+        }
+        return use_data;
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
@@ -223,7 +416,7 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
         const bool skip =
@@ -239,7 +432,7 @@ class counter {
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
         const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
@@ -253,7 +446,7 @@ class counter {
     }
 };
 
-class ThreadSafety : public ValidationObject {
+class ThreadSafety final : public ValidationObject {
   public:
     std::shared_mutex thread_safety_lock;
 
@@ -306,11 +499,12 @@ class ThreadSafety : public ValidationObject {
     ThreadSafety *parent_instance;
 
     ThreadSafety(ThreadSafety *parent)
-        : c_VkCommandBuffer(kVulkanObjectTypeCommandBuffer, this),
-          c_VkDevice(kVulkanObjectTypeDevice, this),
-          c_VkInstance(kVulkanObjectTypeInstance, this),
-          c_VkQueue(kVulkanObjectTypeQueue, this),
-          c_VkCommandPoolContents(kVulkanObjectTypeCommandPool, this),
+        : c_VkCommandBuffer(kVulkanObjectTypeCommandBuffer, this, false),
+          c_VkDevice(kVulkanObjectTypeDevice, this, false),
+          c_VkInstance(kVulkanObjectTypeInstance, this, false),
+          c_VkQueue(kVulkanObjectTypeQueue, this, false),
+          // The command pools are attached to by c_VkCommandPool
+          c_VkCommandPoolContents(kVulkanObjectTypeCommandPool, this, false),
 #ifdef DISTINCT_NONDISPATCHABLE_HANDLES
 #include "generated/thread_safety_counter_instances.h"
 #else   // DISTINCT_NONDISPATCHABLE_HANDLES
@@ -326,7 +520,9 @@ class ThreadSafety : public ValidationObject {
     void StartReadObject(type object, const Location& loc) { c_##type.StartRead(object, loc); }     \
     void FinishReadObject(type object, const Location& loc) { c_##type.FinishRead(object, loc); }   \
     void CreateObject(type object) { c_##type.CreateObject(object); }                                 \
-    void DestroyObject(type object) { c_##type.DestroyObject(object); }
+    void DestroyObject(type object) { c_##type.DestroyObject(object); }                               \
+    bool DetachObject(type object) { return c_##type.DetachUse(object); }                             \
+    void FinishDetachedReadObject(type object, const Location& loc) { c_##type.FinishDetachedRead(object, loc); }
 
 #define WRAPPER_PARENT_INSTANCE(type)                                                                                           \
     void StartWriteObjectParentInstance(type object, const Location& loc) {                                                       \
@@ -342,7 +538,13 @@ class ThreadSafety : public ValidationObject {
         (parent_instance ? parent_instance : this)->c_##type.FinishRead(object, loc);                                       \
     }                                                                                                                           \
     void CreateObjectParentInstance(type object) { (parent_instance ? parent_instance : this)->c_##type.CreateObject(object); } \
-    void DestroyObjectParentInstance(type object) { (parent_instance ? parent_instance : this)->c_##type.DestroyObject(object); }
+    void DestroyObjectParentInstance(type object) { (parent_instance ? parent_instance : this)->c_##type.DestroyObject(object); } \
+    bool DetachObjectParentInstance(type object) {                                                                              \
+        return (parent_instance ? parent_instance : this)->c_##type.DetachUse(object);                                          \
+    }                                                                                                                           \
+    void FinishDetachedReadObjectParentInstance(type object, const Location& loc) {                                             \
+        (parent_instance ? parent_instance : this)->c_##type.FinishDetachedRead(object, loc);                                   \
+    }
 
     WRAPPER_PARENT_INSTANCE(VkDevice)
     WRAPPER_PARENT_INSTANCE(VkInstance)
@@ -0,0 +1,106 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arena.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace vvl {
+
+static size_t AlignUp(size_t offset, size_t alignment) { return (offset + alignment - 1) & ~(alignment - 1); }
+
+Arena::Arena(size_t block_size) : block_size_(block_size) {
+    for (auto &free_list : free_lists_) {
+        free_list.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void *Arena::Allocate(size_t size, size_t alignment) {
+    // Blocks come from operator new[], so their start has the default new alignment
+    assert(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    if (size > kMaxReusedSize) {
+        return AllocateFromBlock(size, alignment);
+    }
+    size = std::max(AlignUp(size, kSizeGranularity), kSizeGranularity);
+    std::atomic<FreeChunk *> &free_list = free_lists_[size / kSizeGranularity - 1];
+    FreeChunk *chunk = free_list.load(std::memory_order_acquire);
+    while (chunk && !free_list.compare_exchange_weak(chunk, chunk->next, std::memory_order_acquire)) {
+    }
+    if (chunk) {
+        return chunk;
+    }
+    return AllocateFromBlock(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void Arena::Free(void *p, size_t size) {
+    if (!p || size > kMaxReusedSize) {
+        return;
+    }
+    size = std::max(AlignUp(size, kSizeGranularity), kSizeGranularity);
+    std::atomic<FreeChunk *> &free_list = free_lists_[size / kSizeGranularity - 1];
+    FreeChunk *chunk = static_cast<FreeChunk *>(p);
+    chunk->next = free_list.load(std::memory_order_relaxed);
+    while (!free_list.compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+void *Arena::AllocateFromBlock(size_t size, size_t alignment) {
+    if (current_block_ < blocks_.size()) {
+        Block &block = blocks_[current_block_];
+        const size_t offset = AlignUp(offset_, alignment);
+        if (offset + size <= block.size) {
+            offset_ = offset + size;
+            return block.data.get() + offset;
+        }
+    }
+    // The start of every block is aligned
+    return AllocateFromNextBlock(size);
+}
+
+void *Arena::AllocateFromNextBlock(size_t size) {
+    // Skip over the remainder of the current block. Blocks kept from before the last Reset() are reused if big enough.
+    size_t next_block = (current_block_ < blocks_.size()) ? current_block_ + 1 : current_block_;
+    while (next_block < blocks_.size() && blocks_[next_block].size < size) {
+        ++next_block;
+    }
+    if (next_block == blocks_.size()) {
+        const size_t block_size = std::max(block_size_, size);
+        blocks_.push_back(Block{std::unique_ptr<std::byte[]>(new std::byte[block_size]), block_size});
+    }
+    current_block_ = next_block;
+    offset_ = size;
+    return blocks_[current_block_].data.get();
+}
+
+void Arena::Reset() {
+    current_block_ = 0;
+    offset_ = 0;
+    for (auto &free_list : free_lists_) {
+        free_list.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+size_t Arena::Capacity() const {
+    size_t capacity = 0;
+    for (const auto &block : blocks_) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+}  // namespace vvl
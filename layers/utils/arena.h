@@ -0,0 +1,132 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace vvl {
+
+// Bump allocator for objects which all go away together, like the state recorded for a command buffer.
+// All the memory is reclaimed at once by Reset(), which keeps the blocks to be reused by the next round of allocations.
+//
+// Only the memory is reclaimed at once, the objects still have to be destroyed one by one before Reset(), so a container
+// using the arena costs as much to destroy as it would with the heap. Small allocations (map nodes, shared objects) that are
+// freed go to a free list per size and are handed out again before Reset(), so a map being updated in place doesn't make the
+// arena grow. Bigger allocations (the storage of a growing vector) are only reclaimed by Reset().
+//
+// Allocate() and Reset() must be externally synchronized, they are done by the owner of the arena. Free() can be called from
+// any thread, by whoever releases the last reference to something allocated from the arena.
+class Arena {
+  public:
+    static constexpr size_t kDefaultBlockSize = 64 * 1024;
+    // Allocations up to this size are reused once freed. They are rounded up to a multiple of kSizeGranularity and get the
+    // default new alignment, so that any freed allocation of a size class fits the next one.
+    static constexpr size_t kMaxReusedSize = 1024;
+    static constexpr size_t kSizeGranularity = 16;
+
+    explicit Arena(size_t block_size = kDefaultBlockSize);
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment);
+    // size must be the one given to Allocate()
+    void Free(void *p, size_t size);
+
+    // Nothing allocated from the arena may be used after this, and nothing may be freed concurrently
+    void Reset();
+
+    // Total size of the blocks owned by the arena
+    size_t Capacity() const;
+
+  private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+    // Overlays a freed allocation. Any thread can push to a free list, only the owner pops from it, so there is no ABA.
+    struct FreeChunk {
+        FreeChunk *next;
+    };
+    static constexpr size_t kFreeListCount = kMaxReusedSize / kSizeGranularity;
+
+    void *AllocateFromBlock(size_t size, size_t alignment);
+    void *AllocateFromNextBlock(size_t size);
+
+    const size_t block_size_;
+    std::vector<Block> blocks_;
+    size_t current_block_ = 0;
+    size_t offset_ = 0;
+    std::array<std::atomic<FreeChunk *>, kFreeListCount> free_lists_;
+};
+
+// Standard allocator allocating from a shared Arena, which it keeps alive, or from the heap when there is no arena.
+//
+// Containers copied from an arena container get a heap allocator, so copies that outlive the original (or are modified long
+// after) don't keep the arena alive or grow it. A copy that belongs with the original is made by passing the allocator to the
+// constructor explicitly.
+template <typename T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() = default;
+    explicit ArenaAllocator(std::shared_ptr<Arena> arena) : arena_(std::move(arena)) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.GetArena()) {}
+
+    T *allocate(size_t n) {
+        if (arena_) {
+            return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) {
+        if (arena_) {
+            arena_->Free(p, n * sizeof(T));
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+    const std::shared_ptr<Arena> &GetArena() const { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const {
+        return arena_ == other.GetArena();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const {
+        return arena_ != other.GetArena();
+    }
+
+  private:
+    std::shared_ptr<Arena> arena_;
+};
+
+}  // namespace vvl
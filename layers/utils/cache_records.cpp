@@ -0,0 +1,50 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cache_records.h"
+
+#include <algorithm>
+
+#include "hash_util.h"
+
+namespace vvl {
+
+uint32_t *WriteCacheRecord(uint32_t *out, uint32_t type, uint32_t key, const uint32_t *data, size_t data_size) {
+    uint32_t *record = out;
+    out[1] = type;
+    out[2] = static_cast<uint32_t>(1 + data_size);
+    out[3] = key;
+    out = std::copy(data, data + data_size, out + 4);
+    record[0] = hash_util::CacheRecordHash(record + 1, (out - record - 1) * sizeof(uint32_t));
+    return out;
+}
+
+bool ReadCacheRecord(const uint32_t *words, size_t word_count, size_t &pos, CacheRecord &out_record) {
+    if (pos > word_count || word_count - pos < kCacheRecordHeaderWords) return false;
+    const uint32_t *record = words + pos;
+    const uint32_t payload_size = record[2];
+    if (payload_size > word_count - pos - kCacheRecordHeaderWords) return false;
+    if (hash_util::CacheRecordHash(record + 1, (2 + size_t(payload_size)) * sizeof(uint32_t)) != record[0]) return false;
+
+    out_record.type = record[1];
+    out_record.payload = record + kCacheRecordHeaderWords;
+    out_record.payload_size = payload_size;
+    pos += CacheRecordWords(payload_size);
+    return true;
+}
+
+}  // namespace vvl
@@ -0,0 +1,48 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vvl {
+
+// Cache files that are extended by appending records (see AppendToFile()) can end up with a partial record at the end, if
+// the process is killed or the disk fills up in the middle of a write. Each record carries a checksum of its content, so a
+// torn or corrupted record is detected and nothing from it to the end of the file is used.
+//
+// A record is a checksum, its type, the number of words of its payload, then the payload. The checksum covers all the words
+// after it.
+struct CacheRecord {
+    uint32_t type = 0;
+    const uint32_t *payload = nullptr;
+    uint32_t payload_size = 0;
+};
+
+constexpr size_t kCacheRecordHeaderWords = 3;
+
+constexpr size_t CacheRecordWords(size_t payload_words) { return kCacheRecordHeaderWords + payload_words; }
+
+// Writes a record whose payload is key followed by data_size words of data, returns the position right after it
+uint32_t *WriteCacheRecord(uint32_t *out, uint32_t type, uint32_t key, const uint32_t *data, size_t data_size);
+
+// Reads the record that starts at words[pos] and moves pos right after it. Returns false, and leaves pos unchanged, if the
+// record is cut short by the end of the data or doesn't match its checksum.
+bool ReadCacheRecord(const uint32_t *words, size_t word_count, size_t &pos, CacheRecord &out_record);
+
+}  // namespace vvl
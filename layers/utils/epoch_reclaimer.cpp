@@ -0,0 +1,97 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "epoch_reclaimer.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace vvl {
+
+static constexpr uint64_t kIdleEpoch = std::numeric_limits<uint64_t>::max();
+
+EpochReclaimer::Slot::Slot() : epoch(kIdleEpoch) {}
+
+EpochReclaimer::~EpochReclaimer() {
+    for (const Retired &retired : retired_) {
+        retired.deleter(retired.data);
+    }
+    for (Slot *slot = slots_.load(); slot;) {
+        Slot *next = slot->next;
+        delete slot;
+        slot = next;
+    }
+}
+
+EpochReclaimer::Slot *EpochReclaimer::AcquireSlot() {
+    // Slots are never removed from the list, so it can be walked without locking
+    for (auto *slot = slots_.load(); slot; slot = slot->next) {
+        bool in_use = false;
+        if (slot->in_use.compare_exchange_strong(in_use, true)) {
+            return slot;
+        }
+    }
+    auto *slot = new Slot();
+    slot->next = slots_.load();
+    while (!slots_.compare_exchange_weak(slot->next, slot)) {
+    }
+    return slot;
+}
+
+void EpochReclaimer::ReleaseSlot(Slot *slot) {
+    slot->epoch.store(kIdleEpoch);
+    slot->in_use.store(false);
+}
+
+void EpochReclaimer::Leave(Slot *slot) { slot->epoch.store(kIdleEpoch, std::memory_order_release); }
+
+void EpochReclaimer::Retire(void *data, void (*deleter)(void *)) {
+    std::lock_guard<std::mutex> guard(retired_lock_);
+    // Taken after the removal, any thread that could have found data announced an older epoch
+    retired_.push_back({epoch_.fetch_add(1), data, deleter});
+    if (retired_.size() >= next_reclaim_size_) {
+        ReclaimLocked();
+    }
+}
+
+void EpochReclaimer::Reclaim() {
+    std::lock_guard<std::mutex> guard(retired_lock_);
+    ReclaimLocked();
+}
+
+size_t EpochReclaimer::RetiredCount() {
+    std::lock_guard<std::mutex> guard(retired_lock_);
+    return retired_.size();
+}
+
+void EpochReclaimer::ReclaimLocked() {
+    uint64_t oldest_epoch = kIdleEpoch;
+    for (auto *slot = slots_.load(); slot; slot = slot->next) {
+        oldest_epoch = std::min(oldest_epoch, slot->epoch.load());
+    }
+    // Retired in epoch order
+    auto retired_end = retired_.begin();
+    while (retired_end != retired_.end() && retired_end->epoch < oldest_epoch) {
+        retired_end->deleter(retired_end->data);
+        ++retired_end;
+    }
+    retired_.erase(retired_.begin(), retired_end);
+    // Don't rescan on every retire while a long running critical section (a wait, typically) holds back the oldest epoch
+    next_reclaim_size_ = std::max(kMinReclaimSize, retired_.size() * 2);
+}
+
+}  // namespace vvl
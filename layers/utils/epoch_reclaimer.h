@@ -0,0 +1,93 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Epoch based reclamation, to free data that other threads may have found (in a map, say) and still use, without counting
+// references to it.
+//
+// A thread reading such data does it in a critical section, between Enter() and Leave() of its Slot, which announces the
+// global epoch when the section started. Data removed from where threads find it is retired with the epoch of its removal,
+// and only freed once no critical section started at or before that epoch is left. A thread left in a critical section holds
+// back the reclamation of everything retired after it entered, so critical sections must end with the call that started them.
+//
+// Finding the data must be ordered before its removal (a locked or sequentially consistent map) for the announced epoch to
+// cover it.
+class EpochReclaimer {
+  public:
+    // The epoch announced by a thread, in its own cache line as it is written at the start and end of every critical section
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch;
+        std::atomic<bool> in_use{true};
+        Slot *next = nullptr;
+        Slot();
+    };
+
+    EpochReclaimer() = default;
+    // Frees all the retired data, no thread may be in a critical section or still hold a slot
+    ~EpochReclaimer();
+    EpochReclaimer(const EpochReclaimer &) = delete;
+    EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+    // Slots are reused once released, but never freed before the reclaimer
+    Slot *AcquireSlot();
+    void ReleaseSlot(Slot *slot);
+
+    void Enter(Slot *slot) { slot->epoch.store(epoch_.load()); }
+    void Leave(Slot *slot);
+
+    // Frees data with deleter once no thread can be using it anymore. It must not be reachable anymore.
+    void Retire(void *data, void (*deleter)(void *));
+    template <typename T>
+    void Retire(T *data) {
+        Retire(data, [](void *p) { delete static_cast<T *>(p); });
+    }
+
+    // Frees what can be freed now, instead of waiting for enough data to be retired
+    void Reclaim();
+    // The number of retired data not freed yet
+    size_t RetiredCount();
+
+  private:
+    struct Retired {
+        uint64_t epoch;
+        void *data;
+        void (*deleter)(void *);
+    };
+    static constexpr size_t kMinReclaimSize = 64;
+
+    // retired_lock_ must be held
+    void ReclaimLocked();
+
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<Slot *> slots_{nullptr};
+
+    std::mutex retired_lock_;
+    std::vector<Retired> retired_;
+    size_t next_reclaim_size_ = kMinReclaimSize;
+};
+
+}  // namespace vvl
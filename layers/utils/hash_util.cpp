@@ -42,9 +42,19 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize) {
     return XXH32(pCode, codeSize, seed);
 }
 
+uint64_t ShaderContentHash(const void *pCode, const size_t codeSize) {
+    constexpr uint64_t seed = 0;
+    return XXH64(pCode, codeSize, seed);
+}
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     constexpr uint64_t seed = 0;
     return XXH64(info, info_size, seed);
 }
 
+uint32_t CacheRecordHash(const void *data, const size_t size) {
+    constexpr uint32_t seed = 0x4c565643;
+    return XXH32(data, size, seed);
+}
+
 }  // namespace hash_util
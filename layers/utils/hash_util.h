@@ -161,6 +161,12 @@ uint32_t VuidHash(std::string_view vuid);
 
 uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
+// Wider hash of the whole shader, for data keyed by ShaderHash() that must not be applied to the wrong module
+uint64_t ShaderContentHash(const void *pCode, const size_t codeSize);
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
+// Checksum of a record in a cache file, to find out if it was only partially written
+uint32_t CacheRecordHash(const void *data, const size_t size);
+
 }  // namespace hash_util
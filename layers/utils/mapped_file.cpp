@@ -0,0 +1,167 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapped_file.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vvl {
+
+#if defined(_WIN32)
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char *path) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+    std::unique_ptr<MappedFile> mapped_file;
+    LARGE_INTEGER file_size = {};
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        // The view keeps the mapping object (and the file) alive, neither handle is needed after this
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view) {
+                mapped_file.reset(new MappedFile());
+                mapped_file->data_ = static_cast<const uint8_t *>(view);
+                mapped_file->size_ = static_cast<size_t>(file_size.QuadPart);
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return mapped_file;
+}
+
+MappedFile::~MappedFile() { UnmapViewOfFile(data_); }
+
+bool AppendToFile(const char *path, const void *expected_prefix, size_t prefix_size, const void *data, size_t size) {
+    // Without FILE_WRITE_DATA, every write goes to the current end of the file
+    HANDLE file = CreateFileA(path, GENERIC_READ | FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    std::vector<uint8_t> prefix(prefix_size);
+    DWORD bytes_read = 0;
+    bool success = ReadFile(file, prefix.data(), static_cast<DWORD>(prefix_size), &bytes_read, nullptr) &&
+                   bytes_read == prefix_size && std::memcmp(prefix.data(), expected_prefix, prefix_size) == 0;
+    if (success) {
+        DWORD bytes_written = 0;
+        success = WriteFile(file, data, static_cast<DWORD>(size), &bytes_written, nullptr) && bytes_written == size;
+    }
+    CloseHandle(file);
+    return success;
+}
+
+bool WriteFileAtomic(const char *path, const void *data, size_t size) {
+    const std::string tmp_path = std::string(path) + ".tmp-" + std::to_string(GetCurrentProcessId());
+    HANDLE file = CreateFileA(tmp_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    DWORD bytes_written = 0;
+    const bool written = WriteFile(file, data, static_cast<DWORD>(size), &bytes_written, nullptr) && bytes_written == size;
+    CloseHandle(file);
+    if (!written || !MoveFileExA(tmp_path.c_str(), path, MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileA(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+#else
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char *path) {
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return nullptr;
+
+    std::unique_ptr<MappedFile> mapped_file;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        // The mapping holds its own reference to the file, so the descriptor isn't needed after this
+        void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) {
+            mapped_file.reset(new MappedFile());
+            mapped_file->data_ = static_cast<const uint8_t *>(view);
+            mapped_file->size_ = static_cast<size_t>(info.st_size);
+        }
+    }
+    close(fd);
+    return mapped_file;
+}
+
+MappedFile::~MappedFile() { munmap(const_cast<uint8_t *>(data_), size_); }
+
+static bool WriteAll(int fd, const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        const ssize_t written = write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool AppendToFile(const char *path, const void *expected_prefix, size_t prefix_size, const void *data, size_t size) {
+    // With O_APPEND, each write lands at the current end of the file, even if other processes are appending too. If the
+    // file gets renamed over after this, the data goes to the old (unlinked) file and is simply lost, which is fine for a cache.
+    const int fd = open(path, O_RDWR | O_APPEND | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    std::vector<uint8_t> prefix(prefix_size);
+    bool success = pread(fd, prefix.data(), prefix_size, 0) == static_cast<ssize_t>(prefix_size) &&
+                   std::memcmp(prefix.data(), expected_prefix, prefix_size) == 0;
+    if (success) {
+        success = WriteAll(fd, data, size);
+    }
+    close(fd);
+    return success;
+}
+
+bool WriteFileAtomic(const char *path, const void *data, size_t size) {
+    const std::string tmp_path = std::string(path) + ".tmp-" + std::to_string(getpid());
+    const int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (fd < 0) return false;
+
+    const bool written = WriteAll(fd, data, size);
+    close(fd);
+    if (!written || std::rename(tmp_path.c_str(), path) != 0) {
+        unlink(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+}  // namespace vvl
@@ -0,0 +1,54 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace vvl {
+
+// Read-only view of a whole file mapped into memory, so its content can be used in place without being read and copied.
+// The view stays valid (and keeps its content, even if the file gets replaced on disk) until the object is destroyed.
+class MappedFile {
+  public:
+    // Returns nullptr if the file doesn't exist, is empty, or can't be mapped
+    static std::unique_ptr<MappedFile> Open(const char *path);
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const uint8_t *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    MappedFile() = default;
+
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Appends data to the end of an existing file in a single write, but only if the file still starts with expected_prefix.
+// If the file got replaced by a different process in the meantime, nothing is written and false is returned.
+bool AppendToFile(const char *path, const void *expected_prefix, size_t prefix_size, const void *data, size_t size);
+
+// Writes data to a temporary file next to path, then renames it over path, so readers (in this or other processes) either
+// see the previous file or the complete new one, never a partially written file.
+bool WriteFileAtomic(const char *path, const void *data, size_t size);
+
+}  // namespace vvl
@@ -19,12 +19,17 @@
 
 #include "shader_utils.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 #include "generated/device_features.h"
+#include "utils/cache_records.h"
 #include "utils/hash_util.h"
 
 #include "generated/spirv_tools_commit_id.h"
 
-void ValidationCache::GetUUID(uint8_t *uuid) {
+void ValidationCache::GetUUID(uint8_t *uuid) const {
     const char *sha1_str = SPIRV_TOOLS_COMMIT_ID;
     // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
     // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -47,55 +52,177 @@ void ValidationCache::GetUUID(uint8_t *uuid) {
     std::memcpy(uuid + (VK_UUID_SIZE - sizeof(uint32_t)), &spirv_val_option_hash_, sizeof(uint32_t));
 }
 
+// After the header, the data is a small format tag followed by a list of records (see vvl::WriteCacheRecord()), so new kinds of
+// data can be added later. Records are never rewritten, so a cache file can be extended by appending records to it, and a
+// repeated record is ignored when loading.
+static constexpr uint32_t kValidationCacheMagic = 0x4356564c;  // "LVVC"
+static constexpr uint32_t kValidationCacheFormatVersion = 2;
+static constexpr size_t kValidationCacheHeaderSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+enum ValidationCacheRecordType : uint32_t {
+    kGoodShaderHashRecord = 1,  // payload is the shader hash
+    kShaderAnalysisRecord = 2,  // payload is the shader hash, then the serialized spirv::StaticAnalysis
+};
+static constexpr size_t kValidationCacheFileHeaderWords = (kValidationCacheHeaderSize + 2 * sizeof(uint32_t)) / sizeof(uint32_t);
+// Processes running at the same time can append the same records. Past this many, the file is rewritten instead of growing.
+static constexpr size_t kValidationCacheMaxDuplicateRecords = 64;
+
 void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-    auto size = headerSize;
-    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+    if (!pCreateInfo->pInitialData) return;
+    bool intact = false;
+    LoadRecords(static_cast<const uint8_t *>(pCreateInfo->pInitialData), pCreateInfo->initialDataSize, false, intact);
+}
 
-    uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-    if (data[0] != size) return;
-    if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
-    uint8_t expected_uuid[VK_UUID_SIZE];
-    GetUUID(expected_uuid);
-    if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+bool ValidationCache::LoadMapped(std::unique_ptr<vvl::MappedFile> &&file) {
+    bool intact = false;
+    if (!file || !LoadRecords(file->Data(), file->Size(), true, intact)) return false;
+    // Records before a damaged tail are still used in place
+    auto guard = WriteLock();
+    mapped_file_ = std::move(file);
+    return intact;
+}
 
-    data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+bool ValidationCache::LoadRecords(const uint8_t *bytes, size_t size, bool in_place, bool &out_intact) {
+    out_intact = false;
+    if (size < kValidationCacheFileHeaderWords * sizeof(uint32_t)) return false;
+
+    std::vector<uint32_t> expected_header;
+    GetFileHeader(expected_header);
+    // Data written before the records were added, or by a different version, is dropped, it is only a cache
+    if (memcmp(bytes, expected_header.data(), expected_header.size() * sizeof(uint32_t)) != 0) return false;
+
+    const size_t word_count = size / sizeof(uint32_t);
+    // pInitialData has no alignment requirement, unaligned data is read from an aligned copy
+    std::vector<uint32_t> aligned_copy;
+    uint32_t const *data = reinterpret_cast<uint32_t const *>(bytes);
+    if (reinterpret_cast<uintptr_t>(bytes) % alignof(uint32_t) != 0) {
+        // Records loaded in place would point into the copy, mapped files are always page aligned
+        assert(!in_place);
+        if (in_place) return false;
+        aligned_copy.resize(word_count);
+        memcpy(aligned_copy.data(), bytes, word_count * sizeof(uint32_t));
+        data = aligned_copy.data();
+    }
 
     auto guard = WriteLock();
-    for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-        good_shader_hashes_.insert(*data);
+    size_t pos = kValidationCacheFileHeaderWords;
+    size_t duplicate_records = 0;
+    vvl::CacheRecord record;
+    // Stops at the first torn or corrupted record, nothing after it can be trusted
+    while (vvl::ReadCacheRecord(data, word_count, pos, record)) {
+        const uint32_t *payload = record.payload;
+        const uint32_t payload_size = record.payload_size;
+        bool inserted = true;
+        if (record.type == kGoodShaderHashRecord && payload_size == 1) {
+            inserted = good_shader_hashes_.insert(payload[0]).second;
+        } else if (record.type == kShaderAnalysisRecord && payload_size > 1) {
+            if (in_place) {
+                inserted =
+                    mapped_shader_analyses_.emplace(payload[0], vvl::span<const uint32_t>(payload + 1, payload_size - 1)).second;
+            } else {
+                inserted = shader_analyses_.emplace(payload[0], std::vector<uint32_t>(payload + 1, payload + payload_size)).second;
+            }
+        }
+        // Unknown records are skipped
+        if (!inserted) {
+            duplicate_records++;
+        }
+    }
+    out_intact = pos == word_count && size % sizeof(uint32_t) == 0 && duplicate_records <= kValidationCacheMaxDuplicateRecords;
+    return true;
+}
+
+void ValidationCache::GetFileHeader(std::vector<uint32_t> &out_header) const {
+    out_header.resize(kValidationCacheFileHeaderWords);
+    uint32_t *out = out_header.data();
+    *out++ = kValidationCacheHeaderSize;
+    *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+    GetUUID(reinterpret_cast<uint8_t *>(out));
+    out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+    *out++ = kValidationCacheMagic;
+    *out++ = kValidationCacheFormatVersion;
+}
+
+// Writes a record with the hash in front of the payload, returns the position right after it
+template <typename Payload>
+static uint32_t *WriteRecord(uint32_t *out, uint32_t type, uint32_t hash, const Payload &payload) {
+    return vvl::WriteCacheRecord(out, type, hash, payload.data(), payload.size());
+}
+
+// The hash is part of the payload
+static size_t RecordWords(size_t payload_words) { return vvl::CacheRecordWords(1 + payload_words); }
+
+void ValidationCache::GetNewRecords(std::vector<uint32_t> &out_records) const {
+    auto guard = ReadLock();
+    size_t word_count = new_good_shader_hashes_.size() * RecordWords(0);
+    for (uint32_t hash : new_shader_analyses_) {
+        word_count += RecordWords(shader_analyses_.at(hash).size());
+    }
+
+    const size_t offset = out_records.size();
+    out_records.resize(offset + word_count);
+    uint32_t *out = out_records.data() + offset;
+    const std::vector<uint32_t> no_payload;
+    for (uint32_t hash : new_good_shader_hashes_) {
+        out = WriteRecord(out, kGoodShaderHashRecord, hash, no_payload);
+    }
+    for (uint32_t hash : new_shader_analyses_) {
+        out = WriteRecord(out, kShaderAnalysisRecord, hash, shader_analyses_.at(hash));
     }
 }
 
 void ValidationCache::Write(size_t *pDataSize, void *pData) {
-    const auto header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+    auto guard = ReadLock();
+    size_t total_size = kValidationCacheFileHeaderWords * sizeof(uint32_t);
+    total_size += good_shader_hashes_.size() * RecordWords(0) * sizeof(uint32_t);
+    for (const auto &[hash, analysis] : shader_analyses_) {
+        total_size += RecordWords(analysis.size()) * sizeof(uint32_t);
+    }
+    for (const auto &[hash, analysis] : mapped_shader_analyses_) {
+        total_size += RecordWords(analysis.size()) * sizeof(uint32_t);
+    }
     if (!pData) {
-        *pDataSize = header_size + good_shader_hashes_.size() * sizeof(uint32_t);
+        *pDataSize = total_size;
         return;
     }
 
-    if (*pDataSize < header_size) {
+    if (*pDataSize < kValidationCacheFileHeaderWords * sizeof(uint32_t)) {
         *pDataSize = 0;
         return;  // Too small for even the header!
     }
 
-    uint32_t *out = (uint32_t *)pData;
-    size_t actual_size = header_size;
+    // pData has no alignment requirement, so the words are written to a local buffer and copied out at the end
+    std::vector<uint32_t> words(std::min(*pDataSize, total_size) / sizeof(uint32_t));
 
     // Write the header
-    *out++ = header_size;
-    *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-    GetUUID(reinterpret_cast<uint8_t *>(out));
-    out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+    std::vector<uint32_t> header;
+    GetFileHeader(header);
+    uint32_t *out = std::copy(header.begin(), header.end(), words.data());
+    size_t actual_size = header.size() * sizeof(uint32_t);
 
-    {
-        auto guard = ReadLock();
-        for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actual_size < *pDataSize;
-             it++, out++, actual_size += sizeof(uint32_t)) {
-            *out = *it;
+    // Only whole records are written
+    auto write_record = [&out, &actual_size, pDataSize](uint32_t type, uint32_t hash, const auto &payload) {
+        const size_t record_size = RecordWords(payload.size()) * sizeof(uint32_t);
+        if (actual_size + record_size > *pDataSize) {
+            return false;
         }
+        out = WriteRecord(out, type, hash, payload);
+        actual_size += record_size;
+        return true;
+    };
+
+    const std::vector<uint32_t> no_payload;
+    bool fits = true;
+    for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && fits; it++) {
+        fits = write_record(kGoodShaderHashRecord, *it, no_payload);
+    }
+    for (auto it = shader_analyses_.begin(); it != shader_analyses_.end() && fits; it++) {
+        fits = write_record(kShaderAnalysisRecord, it->first, it->second);
+    }
+    for (auto it = mapped_shader_analyses_.begin(); it != mapped_shader_analyses_.end() && fits; it++) {
+        fits = write_record(kShaderAnalysisRecord, it->first, it->second);
     }
 
+    memcpy(pData, words.data(), actual_size);
     *pDataSize = actual_size;
 }
 
@@ -107,7 +234,19 @@ void ValidationCache::Merge(ValidationCache const *other) {
     auto other_guard = other->ReadLock();
     auto guard = WriteLock();
     good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-    for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+    for (auto h : other->good_shader_hashes_) {
+        if (good_shader_hashes_.insert(h).second) {
+            new_good_shader_hashes_.emplace_back(h);
+        }
+    }
+    auto merge_analysis = [this](uint32_t hash, const auto &analysis) {
+        if (mapped_shader_analyses_.count(hash) == 0 &&
+            shader_analyses_.emplace(hash, std::vector<uint32_t>(analysis.begin(), analysis.end())).second) {
+            new_shader_analyses_.emplace_back(hash);
+        }
+    };
+    for (const auto &[hash, analysis] : other->shader_analyses_) merge_analysis(hash, analysis);
+    for (const auto &[hash, analysis] : other->mapped_shader_analyses_) merge_analysis(hash, analysis);
 }
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
@@ -22,6 +22,7 @@
 
 #include "vulkan/vulkan.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/mapped_file.h"
 
 #include <spirv-tools/libspirv.hpp>
 
@@ -80,6 +81,16 @@ class ValidationCache {
     void Write(size_t *pDataSize, void *pData);
     void Merge(ValidationCache const *other);
 
+    // Loads the records of a cache file in place, without copying them. The cache keeps the file mapped until destroyed.
+    // Returns false if the file has a different header (or none), in which case nothing is loaded. Also returns false if the
+    // file ends with a torn or corrupted record, or holds too many duplicate records, in which case the intact records before
+    // it are loaded, but the file must be rewritten instead of appended to.
+    bool LoadMapped(std::unique_ptr<vvl::MappedFile> &&file);
+    // Everything in front of the records, a cache file can only be appended to if it starts with the same header
+    void GetFileHeader(std::vector<uint32_t> &out_header) const;
+    // Records added since the cache was created or loaded, in the form they are appended to the cache file
+    void GetNewRecords(std::vector<uint32_t> &out_records) const;
+
     bool Contains(uint32_t hash) {
         auto guard = ReadLock();
         return good_shader_hashes_.count(hash) != 0;
@@ -87,7 +98,29 @@ class ValidationCache {
 
     void Insert(uint32_t hash) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        if (good_shader_hashes_.insert(hash).second) {
+            new_good_shader_hashes_.emplace_back(hash);
+        }
+    }
+
+    // Serialized spirv::StaticAnalysis of shaders seen before, so they don't have to be walked again
+    bool FindShaderAnalysis(uint32_t hash, std::vector<uint32_t> &out_data) const {
+        auto guard = ReadLock();
+        if (auto it = mapped_shader_analyses_.find(hash); it != mapped_shader_analyses_.end()) {
+            out_data.assign(it->second.begin(), it->second.end());
+            return true;
+        }
+        auto it = shader_analyses_.find(hash);
+        if (it == shader_analyses_.end()) return false;
+        out_data = it->second;
+        return true;
+    }
+
+    void InsertShaderAnalysis(uint32_t hash, std::vector<uint32_t> &&data) {
+        auto guard = WriteLock();
+        if (mapped_shader_analyses_.count(hash) == 0 && shader_analyses_.emplace(hash, std::move(data)).second) {
+            new_shader_analyses_.emplace_back(hash);
+        }
     }
 
   private:
@@ -95,7 +128,10 @@ class ValidationCache {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    void GetUUID(uint8_t *uuid);
+    void GetUUID(uint8_t *uuid) const;
+    // Returns false if data doesn't start with the expected header, otherwise adds the records that follow it. out_intact is
+    // set if the records end exactly at the end of the data, without damage, and with few enough duplicates to keep appending.
+    bool LoadRecords(const uint8_t *data, size_t size, bool in_place, bool &out_intact);
 
     // Can hit cases where error appear/disappear if spirv-val settings are adjusted
     // see https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8031
@@ -106,6 +142,14 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     vvl::unordered_set<uint32_t> good_shader_hashes_;
+    // <shader hash, serialized spirv::StaticAnalysis>, added while running
+    vvl::unordered_map<uint32_t, std::vector<uint32_t>> shader_analyses_;
+    // <shader hash, serialized spirv::StaticAnalysis>, pointing into mapped_file_
+    vvl::unordered_map<uint32_t, vvl::span<const uint32_t>> mapped_shader_analyses_;
+    std::unique_ptr<vvl::MappedFile> mapped_file_;
+    // good_shader_hashes_ and shader_analyses_ keys that were not loaded, in insertion order
+    std::vector<uint32_t> new_good_shader_hashes_;
+    std::vector<uint32_t> new_shader_analyses_;
     mutable std::shared_mutex lock_;
 };
 
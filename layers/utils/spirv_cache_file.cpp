@@ -0,0 +1,96 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "spirv_cache_file.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace vvl {
+
+// The cache file is laid out as:
+//   file key, zero padded to a multiple of 4 bytes
+//   kSpirvCacheFileMagic
+//   entry count
+//   Entry[entry count], sorted by hash so lookups can binary search them in place
+//   SPIR-V of all entries
+static constexpr uint32_t kSpirvCacheFileMagic = 0x43535647;  // "GVSC"
+
+static size_t SpirvCacheFileHeaderSize(size_t file_key_size) {
+    return ((file_key_size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1)) + 2 * sizeof(uint32_t);
+}
+
+bool SpirvCacheFileView::Parse(const MappedFile &file, const void *file_key, size_t file_key_size) {
+    *this = {};
+    const size_t header_size = SpirvCacheFileHeaderSize(file_key_size);
+    if (file.Size() < header_size || std::memcmp(file.Data(), file_key, file_key_size) != 0) {
+        return false;
+    }
+    // Mappings are page aligned, so everything after the padded key is suitably aligned
+    const uint32_t *header = reinterpret_cast<const uint32_t *>(file.Data() + header_size) - 2;
+    const size_t entry_count = header[1];
+    if (header[0] != kSpirvCacheFileMagic || entry_count > (file.Size() - header_size) / sizeof(Entry)) {
+        return false;
+    }
+    const size_t data_offset = header_size + entry_count * sizeof(Entry);
+    entries_ = span<const Entry>(reinterpret_cast<const Entry *>(header + 2), entry_count);
+    spirv_data_ = span<const uint32_t>(reinterpret_cast<const uint32_t *>(file.Data() + data_offset),
+                                       (file.Size() - data_offset) / sizeof(uint32_t));
+    return true;
+}
+
+span<const uint32_t> SpirvCacheFileView::Find(uint32_t spirv_hash) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), spirv_hash,
+                               [](const Entry &entry, uint32_t hash) { return entry.spirv_hash < hash; });
+    if (it == entries_.end() || it->spirv_hash != spirv_hash) {
+        return {};
+    }
+    return Spirv(*it);
+}
+
+span<const uint32_t> SpirvCacheFileView::Spirv(const Entry &entry) const {
+    // A truncated or corrupted file must not make us read out of the mapping
+    if (entry.offset > spirv_data_.size() || entry.dword_count > spirv_data_.size() - entry.offset) {
+        return {};
+    }
+    return span<const uint32_t>(spirv_data_.data() + entry.offset, entry.dword_count);
+}
+
+void SpirvCacheFileView::Write(const void *file_key, size_t file_key_size,
+                               const std::vector<std::pair<uint32_t, span<const uint32_t>>> &shaders,
+                               std::vector<uint32_t> &out_data) {
+    const size_t header_dwords = SpirvCacheFileHeaderSize(file_key_size) / sizeof(uint32_t);
+    const size_t entries_dwords = shaders.size() * sizeof(Entry) / sizeof(uint32_t);
+    size_t spirv_dwords = 0;
+    for (const auto &shader : shaders) {
+        spirv_dwords += shader.second.size();
+    }
+    out_data.assign(header_dwords + entries_dwords + spirv_dwords, 0);
+    std::memcpy(out_data.data(), file_key, file_key_size);
+    out_data[header_dwords - 2] = kSpirvCacheFileMagic;
+    out_data[header_dwords - 1] = static_cast<uint32_t>(shaders.size());
+    Entry *entries = reinterpret_cast<Entry *>(out_data.data() + header_dwords);
+    uint32_t *spirv_data = out_data.data() + header_dwords + entries_dwords;
+    uint32_t offset = 0;
+    for (const auto &[hash, spirv] : shaders) {
+        *entries++ = Entry{hash, offset, static_cast<uint32_t>(spirv.size())};
+        std::copy(spirv.begin(), spirv.end(), spirv_data + offset);
+        offset += static_cast<uint32_t>(spirv.size());
+    }
+}
+
+}  // namespace vvl
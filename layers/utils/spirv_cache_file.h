@@ -0,0 +1,58 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/mapped_file.h"
+
+namespace vvl {
+
+// View of a file holding SPIR-V shaders keyed by a hash, used in place from its mapping. Lookups binary search the entries,
+// so only the pages of the shaders actually looked up are read from disk.
+class SpirvCacheFileView {
+  public:
+    struct Entry {
+        uint32_t spirv_hash;
+        uint32_t offset;  // in dwords, from the start of the SPIR-V data
+        uint32_t dword_count;
+    };
+
+    // Returns false, and leaves the view empty, if the file was written with a different file_key or is not a cache file
+    bool Parse(const MappedFile &file, const void *file_key, size_t file_key_size);
+    // Returns an empty span if the shader is not in the file
+    span<const uint32_t> Find(uint32_t spirv_hash) const;
+    // Returns an empty span if the entry points outside of the file
+    span<const uint32_t> Spirv(const Entry &entry) const;
+    // Sorted by spirv_hash
+    const span<const Entry> &Entries() const { return entries_; }
+
+    // Content of a cache file holding shaders, which must be sorted by hash without duplicates
+    static void Write(const void *file_key, size_t file_key_size,
+                      const std::vector<std::pair<uint32_t, span<const uint32_t>>> &shaders, std::vector<uint32_t> &out_data);
+
+  private:
+    span<const Entry> entries_;
+    span<const uint32_t> spirv_data_;
+};
+
+}  // namespace vvl
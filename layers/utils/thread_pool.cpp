@@ -0,0 +1,144 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace vvl {
+
+static uint32_t DefaultThreadCount() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+ThreadPool::ThreadPool(uint32_t thread_count) : thread_count_(thread_count ? thread_count : DefaultThreadCount()) {}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_ = true;
+    }
+    work_cond_.notify_all();
+    for (auto &thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void ThreadPool::StartThreads() {
+    // lock_ must be held
+    threads_.reserve(thread_count_);
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        threads_.emplace_back(&ThreadPool::ThreadFunc, this);
+    }
+}
+
+uint64_t ThreadPool::Enqueue(Task &&task) {
+    uint64_t ticket;
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (threads_.empty()) {
+            StartThreads();
+        }
+        ticket = next_ticket_++;
+        tasks_.emplace_back(ticket, std::move(task));
+    }
+    work_cond_.notify_one();
+    return ticket;
+}
+
+bool ThreadPool::IsDone(uint64_t ticket) const {
+    // lock_ must be held. Tasks are started in ticket order, so a task is done once it is neither queued nor running.
+    if (!tasks_.empty() && tasks_.front().first <= ticket) {
+        return false;
+    }
+    return std::none_of(running_.begin(), running_.end(), [ticket](uint64_t running) { return running <= ticket; });
+}
+
+void ThreadPool::Wait(uint64_t ticket) {
+    std::unique_lock<std::mutex> guard(lock_);
+    done_cond_.wait(guard, [this, ticket]() { return IsDone(ticket); });
+}
+
+void ThreadPool::WaitIdle() {
+    std::unique_lock<std::mutex> guard(lock_);
+    const uint64_t last_ticket = next_ticket_ - 1;
+    done_cond_.wait(guard, [this, last_ticket]() { return IsDone(last_ticket); });
+}
+
+void ThreadPool::ThreadFunc() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        // Remaining tasks are still executed on exit, so that nothing waiting on them is left hanging
+        work_cond_.wait(guard, [this]() { return exit_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return;
+        }
+        const uint64_t ticket = tasks_.front().first;
+        Task task = std::move(tasks_.front().second);
+        tasks_.pop_front();
+        running_.push_back(ticket);
+
+        guard.unlock();
+        task();
+        guard.lock();
+
+        running_.erase(std::find(running_.begin(), running_.end(), ticket));
+        done_cond_.notify_all();
+    }
+}
+
+void ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &task) {
+    if (count == 0) return;
+
+    struct State {
+        std::atomic<uint32_t> next_index{0};
+        uint32_t finished = 0;
+        std::mutex lock;
+        std::condition_variable finished_cond;
+    };
+    // Helpers may only get to run after all the work is done, so they can outlive this call
+    auto state = std::make_shared<State>();
+    auto run = [state, count, &task]() {
+        uint32_t done = 0;
+        for (uint32_t i = state->next_index++; i < count; i = state->next_index++) {
+            task(i);
+            ++done;
+        }
+        if (done) {
+            std::unique_lock<std::mutex> guard(state->lock);
+            state->finished += done;
+            if (state->finished == count) {
+                state->finished_cond.notify_all();
+            }
+        }
+    };
+
+    // The calling thread takes part too, so this never waits on workers that are busy elsewhere
+    const uint32_t helper_count = std::min(thread_count_, count - 1);
+    for (uint32_t i = 0; i < helper_count; ++i) {
+        // Helpers only touch task after claiming an index, which can't happen once everything is finished
+        Enqueue(Task(run));
+    }
+    run();
+
+    std::unique_lock<std::mutex> guard(state->lock);
+    state->finished_cond.wait(guard, [&state, count]() { return state->finished == count; });
+}
+
+}  // namespace vvl
@@ -0,0 +1,82 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Runs tasks on a fixed set of worker threads, in the order they were enqueued.
+// With a single worker thread, tasks are also guaranteed to execute one after the other, which makes it usable
+// to move work that has to stay ordered (like replaying queue submissions) off of the application thread.
+//
+// Worker threads are created lazily, on the first call to Enqueue(), so an unused pool costs nothing.
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    // thread_count of 0 picks one thread per hardware thread
+    explicit ThreadPool(uint32_t thread_count = 1);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    uint32_t ThreadCount() const { return thread_count_; }
+
+    // Returns a ticket that can be passed to Wait(), tickets are never 0
+    uint64_t Enqueue(Task &&task);
+
+    // Blocks until the task with the given ticket, and all tasks enqueued before it, have finished executing.
+    // Must not be called from a task running on this pool.
+    void Wait(uint64_t ticket);
+
+    // Blocks until all tasks enqueued so far have finished executing.
+    // Must not be called from a task running on this pool.
+    void WaitIdle();
+
+    // Runs task(0) ... task(count - 1) on the pool and the calling thread, returning when all of them are done.
+    // Indices are handed out dynamically, so callers should not make assumptions about which thread runs which index.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &task);
+
+  private:
+    void StartThreads();
+    void ThreadFunc();
+    bool IsDone(uint64_t ticket) const;
+
+    const uint32_t thread_count_;
+    std::vector<std::thread> threads_;
+    std::mutex lock_;
+    // signaled when a task is enqueued or the pool is being destroyed
+    std::condition_variable work_cond_;
+    // signaled when a task finishes
+    std::condition_variable done_cond_;
+    std::deque<std::pair<uint64_t, Task>> tasks_;
+    // tickets of the tasks currently running
+    std::vector<uint64_t> running_;
+    uint64_t next_ticket_{1};
+    bool exit_{false};
+};
+
+}  // namespace vvl
@@ -535,4 +535,12 @@ inline T atomic_fetch_max(std::atomic<T> &current_max, const T &value) noexcept
     return t;
 }
 
+template <typename T>
+inline T atomic_fetch_min(std::atomic<T> &current_min, const T &value) noexcept {
+    T t = current_min.load();
+    while (!current_min.compare_exchange_weak(t, std::min(t, value)))
+        ;
+    return t;
+}
+
 }  // namespace vvl
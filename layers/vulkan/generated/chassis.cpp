@@ -44,7 +44,7 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+UniqueIdMapping unique_id_mapping;
 
 // State we track in order to populate HandleData for things such as ignored pointers
 static vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
@@ -67,6 +67,34 @@ bool wrap_handles = true;
 // This header file must be included after the above validation object class definitions
 #include "chassis_dispatch_helper.h"
 
+template <typename Derived, typename Base>
+using MatchConst = std::conditional_t<std::is_const_v<Base>, const Derived, Derived>;
+
+// Command recording is the hottest path through the chassis. The most commonly enabled validation objects are
+// final, so casting to the concrete type resolves both the lock and the intercept at compile time.
+template <typename VO, typename Func>
+static inline decltype(auto) DispatchToValidationObject(VO* intercept, Func&& func) {
+    static_assert(std::is_final_v<ThreadSafety>);
+    static_assert(std::is_final_v<StatelessValidation>);
+    static_assert(std::is_final_v<ObjectLifetimes>);
+    static_assert(std::is_final_v<CoreChecks>);
+    static_assert(std::is_final_v<SyncValidator>);
+    switch (intercept->container_type) {
+        case LayerObjectTypeThreading:
+            return func(static_cast<MatchConst<ThreadSafety, VO>*>(intercept));
+        case LayerObjectTypeParameterValidation:
+            return func(static_cast<MatchConst<StatelessValidation, VO>*>(intercept));
+        case LayerObjectTypeObjectTracker:
+            return func(static_cast<MatchConst<ObjectLifetimes, VO>*>(intercept));
+        case LayerObjectTypeCoreValidation:
+            return func(static_cast<MatchConst<CoreChecks, VO>*>(intercept));
+        case LayerObjectTypeSyncValidation:
+            return func(static_cast<MatchConst<SyncValidator, VO>*>(intercept));
+        default:
+            return func(intercept);
+    }
+}
+
 // Extension exposed by the validation layer
 static constexpr std::array<VkExtensionProperties, 4> kInstanceExtensions = {
     VkExtensionProperties{VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION},
@@ -4383,8 +4411,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4392,8 +4422,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            });
         }
     }
     {
@@ -4403,8 +4435,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            });
         }
     }
 }
@@ -4419,8 +4453,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4428,8 +4464,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, record_obj);
+            });
         }
     }
     {
@@ -4439,8 +4477,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, record_obj);
+            });
         }
     }
 }
@@ -4455,8 +4495,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4464,8 +4506,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, record_obj);
+            });
         }
     }
     {
@@ -4475,8 +4519,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, record_obj);
+            });
         }
     }
 }
@@ -4490,8 +4536,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4499,8 +4547,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth, record_obj);
+            });
         }
     }
     {
@@ -4510,8 +4560,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth, record_obj);
+            });
         }
     }
 }
@@ -4526,9 +4578,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp,
-                                                              depthBiasSlopeFactor, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp,
+                                                          depthBiasSlopeFactor, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4536,9 +4590,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor,
-                                                    record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor,
+                                                 record_obj);
+            });
         }
     }
     {
@@ -4548,9 +4604,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor,
-                                                     record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor,
+                                                  record_obj);
+            });
         }
     }
 }
@@ -4564,8 +4622,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4573,8 +4633,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants, record_obj);
+            });
         }
     }
     {
@@ -4584,8 +4646,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants, record_obj);
+            });
         }
     }
 }
@@ -4599,8 +4663,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4608,8 +4674,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, record_obj);
+            });
         }
     }
     {
@@ -4619,8 +4687,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, record_obj);
+            });
         }
     }
 }
@@ -4636,8 +4706,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4645,8 +4717,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, record_obj);
+            });
         }
     }
     {
@@ -4656,8 +4730,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, record_obj);
+            });
         }
     }
 }
@@ -4671,8 +4747,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4680,8 +4758,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, record_obj);
+            });
         }
     }
     {
@@ -4691,8 +4771,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, record_obj);
+            });
         }
     }
 }
@@ -4706,8 +4788,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4715,8 +4799,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference, record_obj);
+            });
         }
     }
     {
@@ -4726,8 +4812,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference, record_obj);
+            });
         }
     }
 }
@@ -4744,10 +4832,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet,
-                                                                    descriptorSetCount, pDescriptorSets, dynamicOffsetCount,
-                                                                    pDynamicOffsets, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet,
+                                                                descriptorSetCount, pDescriptorSets, dynamicOffsetCount,
+                                                                pDynamicOffsets, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4755,9 +4845,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
-                                                          pDescriptorSets, dynamicOffsetCount, pDynamicOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                                       pDescriptorSets, dynamicOffsetCount, pDynamicOffsets, record_obj);
+            });
         }
     }
     {
@@ -4768,9 +4860,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
-                                                           pDescriptorSets, dynamicOffsetCount, pDynamicOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                                        pDescriptorSets, dynamicOffsetCount, pDynamicOffsets, record_obj);
+            });
         }
     }
 }
@@ -4785,8 +4879,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4794,8 +4890,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, record_obj);
+            });
         }
     }
     {
@@ -4805,8 +4903,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType, record_obj);
+            });
         }
     }
 }
@@ -4821,9 +4921,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
-                                                                   error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
+                                                               error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4831,8 +4933,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, record_obj);
+            });
         }
     }
     {
@@ -4842,9 +4946,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
-                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, record_obj);
+            });
         }
     }
 }
@@ -4859,9 +4964,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4869,8 +4975,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
+            });
         }
     }
     {
@@ -4880,8 +4988,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
+            });
         }
     }
 }
@@ -4896,9 +5006,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
-                                                             firstInstance, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
+                                                         firstInstance, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4906,9 +5018,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
-                                                   firstInstance, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance,
+                                                record_obj);
+            });
         }
     }
     {
@@ -4918,9 +5032,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
-                                                    firstInstance, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance,
+                                                 record_obj);
+            });
         }
     }
 }
@@ -4935,8 +5051,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4944,8 +5062,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -4955,8 +5075,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -4971,8 +5093,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -4980,8 +5104,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -4991,8 +5117,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -5007,8 +5135,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t g
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5016,8 +5146,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t g
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
     {
@@ -5027,8 +5159,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t g
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
 }
@@ -5042,8 +5176,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5051,8 +5187,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
+            });
         }
     }
     {
@@ -5062,8 +5200,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
+            });
         }
     }
 }
@@ -5078,8 +5218,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5087,8 +5229,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, record_obj);
+            });
         }
     }
     {
@@ -5098,8 +5242,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, record_obj);
+            });
         }
     }
 }
@@ -5115,9 +5261,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
-                                                           regionCount, pRegions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+                                                       regionCount, pRegions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5125,9 +5273,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                 pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                              pRegions, record_obj);
+            });
         }
     }
     {
@@ -5137,9 +5287,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                  pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                               pRegions, record_obj);
+            });
         }
     }
 }
@@ -5155,9 +5307,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
-                                                           regionCount, pRegions, filter, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+                                                       regionCount, pRegions, filter, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5165,9 +5319,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                 pRegions, filter, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                              pRegions, filter, record_obj);
+            });
         }
     }
     {
@@ -5177,9 +5333,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                  pRegions, filter, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                               pRegions, filter, record_obj);
+            });
         }
     }
 }
@@ -5195,9 +5353,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount,
-                                                                   pRegions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount,
+                                                               pRegions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5205,9 +5365,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions,
-                                                         record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions,
+                                                      record_obj);
+            });
         }
     }
     {
@@ -5217,9 +5379,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions,
-                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions,
+                                                       record_obj);
+            });
         }
     }
 }
@@ -5234,9 +5398,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount,
-                                                                   pRegions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount,
+                                                               pRegions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5244,9 +5410,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions,
-                                                         record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions,
+                                                      record_obj);
+            });
         }
     }
     {
@@ -5256,9 +5424,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions,
-                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions,
+                                                       record_obj);
+            });
         }
     }
 }
@@ -5273,8 +5443,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5282,8 +5454,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
+            });
         }
     }
     {
@@ -5293,8 +5467,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
+            });
         }
     }
 }
@@ -5309,8 +5485,10 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5318,8 +5496,10 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
+            });
         }
     }
     {
@@ -5329,8 +5509,10 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
+            });
         }
     }
 }
@@ -5346,9 +5528,11 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges,
-                                                                 error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges,
+                                                             error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5356,8 +5540,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
+            });
         }
     }
     {
@@ -5367,8 +5553,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
+            });
         }
     }
 }
@@ -5385,9 +5573,11 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil,
-                                                                        rangeCount, pRanges, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount,
+                                                                    pRanges, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5395,9 +5585,11 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges,
-                                                              record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges,
+                                                           record_obj);
+            });
         }
     }
     {
@@ -5407,9 +5599,11 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount,
-                                                               pRanges, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges,
+                                                            record_obj);
+            });
         }
     }
 }
@@ -5425,9 +5619,11 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects,
-                                                                  error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects,
+                                                              error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5435,9 +5631,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects,
-                                                        record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects, record_obj);
+            });
         }
     }
     {
@@ -5447,9 +5644,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects,
-                                                         record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects, record_obj);
+            });
         }
     }
 }
@@ -5465,9 +5663,11 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
-                                                              regionCount, pRegions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+                                                          regionCount, pRegions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5475,9 +5675,11 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                    pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                                 pRegions, record_obj);
+            });
         }
     }
     {
@@ -5487,9 +5689,11 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
-                                                     pRegions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                                                  pRegions, record_obj);
+            });
         }
     }
 }
@@ -5503,8 +5707,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5512,8 +5718,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
     {
@@ -5523,8 +5731,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
 }
@@ -5538,8 +5748,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5547,8 +5759,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
     {
@@ -5558,8 +5772,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
 }
@@ -5577,10 +5793,13 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWaitEvents(
-                commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers,
-                bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask,
+                                                        memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                        pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers,
+                                                        error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5588,10 +5807,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask,
-                                                  memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
-                                                  pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                                               pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+                                               imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            });
         }
     }
     {
@@ -5602,10 +5823,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWaitEvents(
-                commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers,
-                bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                                                pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+                                                imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            });
         }
     }
 }
@@ -5623,10 +5846,13 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPipelineBarrier(
-                commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
-                bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                                                             memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                             pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers,
+                                                             error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5634,10 +5860,12 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPipelineBarrier(
-                commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
-                bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                                                    pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+                                                    imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            });
         }
     }
     {
@@ -5648,10 +5876,13 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPipelineBarrier(
-                commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
-                bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                                                     memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                     pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers,
+                                                     record_obj);
+            });
         }
     }
 }
@@ -5666,8 +5897,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5675,8 +5908,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags, record_obj);
+            });
         }
     }
     {
@@ -5686,8 +5921,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags, record_obj);
+            });
         }
     }
 }
@@ -5701,8 +5938,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5710,8 +5949,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query, record_obj);
+            });
         }
     }
     {
@@ -5721,8 +5962,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query, record_obj);
+            });
         }
     }
 }
@@ -5737,8 +5980,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5746,8 +5991,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, record_obj);
+            });
         }
     }
     {
@@ -5757,8 +6004,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount, record_obj);
+            });
         }
     }
 }
@@ -5773,8 +6022,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5782,8 +6033,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, record_obj);
+            });
         }
     }
     {
@@ -5793,8 +6046,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query, record_obj);
+            });
         }
     }
 }
@@ -5810,9 +6065,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer,
-                                                                      dstOffset, stride, flags, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer,
+                                                                  dstOffset, stride, flags, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5820,9 +6077,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
-                                                            stride, flags, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
+                                                         stride, flags, record_obj);
+            });
         }
     }
     {
@@ -5832,9 +6091,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
-                                                             stride, flags, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
+                                                          stride, flags, record_obj);
+            });
         }
     }
 }
@@ -5849,8 +6110,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5858,8 +6121,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, record_obj);
+            });
         }
     }
     {
@@ -5869,8 +6134,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, record_obj);
+            });
         }
     }
 }
@@ -5885,8 +6152,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5894,8 +6163,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
+            });
         }
     }
     {
@@ -5905,8 +6176,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
+            });
         }
     }
 }
@@ -5920,8 +6193,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdNextSubpass(commandBuffer, contents, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdNextSubpass(commandBuffer, contents, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5929,8 +6204,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
+            });
         }
     }
     {
@@ -5940,8 +6217,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
+            });
         }
     }
 }
@@ -5955,8 +6234,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndRenderPass(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndRenderPass(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -5964,8 +6245,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -5975,8 +6258,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -5991,8 +6276,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -6000,8 +6287,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
+            });
         }
     }
     {
@@ -6011,8 +6300,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
+            });
         }
     }
 }
@@ -6146,8 +6437,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint3
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -6155,8 +6448,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint3
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask, record_obj);
+            });
         }
     }
     {
@@ -6166,8 +6461,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint3
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask, record_obj);
+            });
         }
     }
 }
@@ -6182,9 +6479,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
-                                                              groupCountY, groupCountZ, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
+                                                          groupCountY, groupCountZ, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -6192,9 +6491,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
-                                                    groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                                                 groupCountZ, record_obj);
+            });
         }
     }
     {
@@ -6204,9 +6505,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
-                                                     groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                                                  groupCountZ, record_obj);
+            });
         }
     }
 }
@@ -7089,9 +7392,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                   maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                               maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7099,9 +7404,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                         maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                      stride, record_obj);
+            });
         }
     }
     {
@@ -7111,9 +7418,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                          maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                       stride, record_obj);
+            });
         }
     }
 }
@@ -7131,9 +7440,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer,
-                                                                          countBufferOffset, maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer,
+                                                                      countBufferOffset, maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7141,9 +7452,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                             maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -7153,9 +7466,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                 maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                              maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -7209,8 +7524,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7218,8 +7535,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            });
         }
     }
     {
@@ -7229,8 +7548,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            });
         }
     }
 }
@@ -7245,8 +7566,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7254,8 +7577,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            });
         }
     }
     {
@@ -7265,8 +7590,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            });
         }
     }
 }
@@ -7280,8 +7607,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7289,8 +7618,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+            });
         }
     }
     {
@@ -7300,8 +7631,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+            });
         }
     }
 }
@@ -7740,8 +8073,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent e
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetEvent2(commandBuffer, event, pDependencyInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetEvent2(commandBuffer, event, pDependencyInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7749,8 +8084,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent e
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
+            });
         }
     }
     {
@@ -7760,8 +8097,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent e
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
+            });
         }
     }
 }
@@ -7775,8 +8114,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResetEvent2(commandBuffer, event, stageMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResetEvent2(commandBuffer, event, stageMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7784,8 +8125,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
     {
@@ -7795,8 +8138,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
 }
@@ -7811,8 +8156,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7820,8 +8167,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            });
         }
     }
     {
@@ -7831,8 +8180,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            });
         }
     }
 }
@@ -7846,8 +8197,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPipelineBarrier2(commandBuffer, pDependencyInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPipelineBarrier2(commandBuffer, pDependencyInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7855,8 +8208,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
+            });
         }
     }
     {
@@ -7866,8 +8221,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
+            });
         }
     }
 }
@@ -7882,8 +8239,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7891,8 +8250,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, record_obj);
+            });
         }
     }
     {
@@ -7902,8 +8263,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkP
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query, record_obj);
+            });
         }
     }
 }
@@ -7959,8 +8322,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -7968,8 +8333,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, record_obj);
+            });
         }
     }
     {
@@ -7979,8 +8346,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo, record_obj);
+            });
         }
     }
 }
@@ -7994,8 +8363,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImage2(commandBuffer, pCopyImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImage2(commandBuffer, pCopyImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8003,8 +8374,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo, record_obj);
+            });
         }
     }
     {
@@ -8014,8 +8387,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo, record_obj);
+            });
         }
     }
 }
@@ -8030,8 +8405,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8039,8 +8416,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            });
         }
     }
     {
@@ -8050,8 +8429,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            });
         }
     }
 }
@@ -8066,8 +8447,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8075,8 +8458,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            });
         }
     }
     {
@@ -8086,8 +8471,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            });
         }
     }
 }
@@ -8101,8 +8488,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBlitImage2(commandBuffer, pBlitImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBlitImage2(commandBuffer, pBlitImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8110,8 +8499,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo, record_obj);
+            });
         }
     }
     {
@@ -8121,8 +8512,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const Vk
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo, record_obj);
+            });
         }
     }
 }
@@ -8136,8 +8529,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResolveImage2(commandBuffer, pResolveImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResolveImage2(commandBuffer, pResolveImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8145,8 +8540,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
+            });
         }
     }
     {
@@ -8156,8 +8553,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
+            });
         }
     }
 }
@@ -8171,8 +8570,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRendering]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginRendering(commandBuffer, pRenderingInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginRendering(commandBuffer, pRenderingInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8180,8 +8581,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRendering]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+            });
         }
     }
     {
@@ -8191,8 +8594,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRendering]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+            });
         }
     }
 }
@@ -8206,8 +8611,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRendering]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndRendering(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndRendering(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8215,8 +8622,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRendering]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndRendering(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndRendering(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -8226,8 +8635,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRendering]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndRendering(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndRendering(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -8241,8 +8652,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullM
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullMode]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCullMode(commandBuffer, cullMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCullMode(commandBuffer, cullMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8250,8 +8663,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullM
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullMode]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCullMode(commandBuffer, cullMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCullMode(commandBuffer, cullMode, record_obj);
+            });
         }
     }
     {
@@ -8261,8 +8676,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullM
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullMode]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCullMode(commandBuffer, cullMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCullMode(commandBuffer, cullMode, record_obj);
+            });
         }
     }
 }
@@ -8276,8 +8693,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFron
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFace]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetFrontFace(commandBuffer, frontFace, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetFrontFace(commandBuffer, frontFace, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8285,8 +8704,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFron
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFace]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetFrontFace(commandBuffer, frontFace, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetFrontFace(commandBuffer, frontFace, record_obj);
+            });
         }
     }
     {
@@ -8296,8 +8717,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFron
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFace]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetFrontFace(commandBuffer, frontFace, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetFrontFace(commandBuffer, frontFace, record_obj);
+            });
         }
     }
 }
@@ -8311,8 +8734,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopology]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8320,8 +8745,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopology]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, record_obj);
+            });
         }
     }
     {
@@ -8331,8 +8758,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopology]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology, record_obj);
+            });
         }
     }
 }
@@ -8347,8 +8776,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCount]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8356,8 +8787,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, record_obj);
+            });
         }
     }
     {
@@ -8367,8 +8800,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, record_obj);
+            });
         }
     }
 }
@@ -8382,8 +8817,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCount]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8391,8 +8828,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, record_obj);
+            });
         }
     }
     {
@@ -8402,8 +8841,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCount]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, record_obj);
+            });
         }
     }
 }
@@ -8419,9 +8860,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
-                                                                    pSizes, pStrides, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
+                                                                pSizes, pStrides, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8429,9 +8872,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
-                                                          pStrides, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
+                                                       pStrides, record_obj);
+            });
         }
     }
     {
@@ -8441,9 +8886,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
-                                                           pStrides, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
+                                                        pStrides, record_obj);
+            });
         }
     }
 }
@@ -8457,8 +8904,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthTestEnable(commandBuffer, depthTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthTestEnable(commandBuffer, depthTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8466,8 +8915,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable, record_obj);
+            });
         }
     }
     {
@@ -8477,8 +8928,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable, record_obj);
+            });
         }
     }
 }
@@ -8492,8 +8945,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8501,8 +8956,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, record_obj);
+            });
         }
     }
     {
@@ -8512,8 +8969,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable, record_obj);
+            });
         }
     }
 }
@@ -8527,8 +8986,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOp]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthCompareOp(commandBuffer, depthCompareOp, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthCompareOp(commandBuffer, depthCompareOp, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8536,8 +8997,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp, record_obj);
+            });
         }
     }
     {
@@ -8547,8 +9010,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp, record_obj);
+            });
         }
     }
 }
@@ -8564,8 +9029,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8573,8 +9040,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, record_obj);
+            });
         }
     }
     {
@@ -8584,8 +9053,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable, record_obj);
+            });
         }
     }
 }
@@ -8599,8 +9070,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8608,8 +9081,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, record_obj);
+            });
         }
     }
     {
@@ -8619,8 +9094,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable, record_obj);
+            });
         }
     }
 }
@@ -8635,9 +9112,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkSten
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOp]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp,
-                                                              error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp,
+                                                          error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8645,8 +9124,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkSten
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            });
         }
     }
     {
@@ -8656,8 +9137,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkSten
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOp]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            });
         }
     }
 }
@@ -8673,8 +9156,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8682,8 +9167,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, record_obj);
+            });
         }
     }
     {
@@ -8693,8 +9180,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable, record_obj);
+            });
         }
     }
 }
@@ -8708,8 +9197,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8717,8 +9208,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, record_obj);
+            });
         }
     }
     {
@@ -8728,8 +9221,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable, record_obj);
+            });
         }
     }
 }
@@ -8745,8 +9240,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnable]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -8754,8 +9251,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, record_obj);
+            });
         }
     }
     {
@@ -8765,8 +9264,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnable]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable, record_obj);
+            });
         }
     }
 }
@@ -10577,8 +11078,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginVideoCodingKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10586,8 +11089,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, record_obj);
+            });
         }
     }
     {
@@ -10597,8 +11102,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo, record_obj);
+            });
         }
     }
 }
@@ -10612,8 +11119,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndVideoCodingKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10621,8 +11130,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, record_obj);
+            });
         }
     }
     {
@@ -10632,8 +11143,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo, record_obj);
+            });
         }
     }
 }
@@ -10649,8 +11162,10 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdControlVideoCodingKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10658,8 +11173,10 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdControlVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, record_obj);
+            });
         }
     }
     {
@@ -10669,8 +11186,10 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdControlVideoCodingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo, record_obj);
+            });
         }
     }
 }
@@ -10684,8 +11203,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecodeVideoKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10693,8 +11214,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecodeVideoKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, record_obj);
+            });
         }
     }
     {
@@ -10704,8 +11227,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecodeVideoKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo, record_obj);
+            });
         }
     }
 }
@@ -10719,8 +11244,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderingKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10728,8 +11255,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, record_obj);
+            });
         }
     }
     {
@@ -10739,8 +11268,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, record_obj);
+            });
         }
     }
 }
@@ -10754,8 +11285,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderingKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndRenderingKHR(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndRenderingKHR(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -10763,8 +11296,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndRenderingKHR(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndRenderingKHR(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -10774,8 +11309,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderingKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndRenderingKHR(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndRenderingKHR(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -11106,8 +11643,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11115,8 +11654,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask, record_obj);
+            });
         }
     }
     {
@@ -11126,8 +11667,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask, record_obj);
+            });
         }
     }
 }
@@ -11143,9 +11686,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
-                                                                 groupCountY, groupCountZ, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
+                                                             groupCountY, groupCountZ, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11153,9 +11698,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
-                                                       groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                                                    groupCountZ, record_obj);
+            });
         }
     }
     {
@@ -11165,9 +11712,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
-                                                        groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                                                     groupCountZ, record_obj);
+            });
         }
     }
 }
@@ -11667,9 +12216,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set,
-                                                                      descriptorWriteCount, pDescriptorWrites, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set,
+                                                                  descriptorWriteCount, pDescriptorWrites, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11677,9 +12228,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
-                                                            pDescriptorWrites, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                                         pDescriptorWrites, record_obj);
+            });
         }
     }
     {
@@ -11689,9 +12242,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
-                                                             pDescriptorWrites, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                                          pDescriptorWrites, record_obj);
+            });
         }
     }
 }
@@ -11709,9 +12264,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout,
-                                                                                  set, pData, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set,
+                                                                              pData, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11720,9 +12277,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData,
-                                                                        record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData,
+                                                                     record_obj);
+            });
         }
     }
     {
@@ -11733,9 +12292,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set,
-                                                                         pData, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData,
+                                                                      record_obj);
+            });
         }
     }
 }
@@ -11919,8 +12480,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11928,8 +12491,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            });
         }
     }
     {
@@ -11939,8 +12504,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+            });
         }
     }
 }
@@ -11955,8 +12522,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11964,8 +12533,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            });
         }
     }
     {
@@ -11975,8 +12546,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+            });
         }
     }
 }
@@ -11990,8 +12563,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -11999,8 +12574,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, record_obj);
+            });
         }
     }
     {
@@ -12010,8 +12587,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, record_obj);
+            });
         }
     }
 }
@@ -13001,9 +13580,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                      maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                  maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -13011,9 +13592,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                            maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                         maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -13023,9 +13606,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                             maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                          maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -13043,9 +13628,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer,
-                                                                             countBufferOffset, maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer,
+                                                                         countBufferOffset, maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -13053,9 +13640,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                   maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -13065,9 +13654,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                    maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                 maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -13251,8 +13842,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -13260,8 +13853,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, record_obj);
+            });
         }
     }
     {
@@ -13271,8 +13866,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps, record_obj);
+            });
         }
     }
 }
@@ -13289,8 +13886,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRenderingAttachmentLocationsKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -13299,8 +13898,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRenderingAttachmentLocationsKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, record_obj);
+            });
         }
     }
     {
@@ -13311,8 +13912,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRenderingAttachmentLocationsKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo, record_obj);
+            });
         }
     }
 }
@@ -13329,9 +13932,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRenderingInputAttachmentIndicesKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo,
-                                                                                       error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo,
+                                                                                   error_obj);
+            });
             if (skip) return;
         }
     }
@@ -13340,8 +13945,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRenderingInputAttachmentIndicesKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo, record_obj);
+            });
         }
     }
     {
@@ -13352,8 +13959,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRenderingInputAttachmentIndicesKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo, record_obj);
+            });
         }
     }
 }
@@ -14032,8 +14641,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEncodeVideoKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14041,8 +14652,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEncodeVideoKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, record_obj);
+            });
         }
     }
     {
@@ -14052,8 +14665,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEncodeVideoKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo, record_obj);
+            });
         }
     }
 }
@@ -14067,8 +14682,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEven
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14076,8 +14693,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEven
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, record_obj);
+            });
         }
     }
     {
@@ -14087,8 +14706,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEven
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo, record_obj);
+            });
         }
     }
 }
@@ -14102,8 +14723,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEv
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResetEvent2KHR(commandBuffer, event, stageMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResetEvent2KHR(commandBuffer, event, stageMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14111,8 +14734,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEv
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
     {
@@ -14122,8 +14747,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEv
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask, record_obj);
+            });
         }
     }
 }
@@ -14138,8 +14765,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14147,8 +14776,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            });
         }
     }
     {
@@ -14158,8 +14789,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
+            });
         }
     }
 }
@@ -14173,8 +14806,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14182,8 +14817,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, record_obj);
+            });
         }
     }
     {
@@ -14193,8 +14830,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, record_obj);
+            });
         }
     }
 }
@@ -14209,8 +14848,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14218,8 +14859,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, record_obj);
+            });
         }
     }
     {
@@ -14229,8 +14872,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query, record_obj);
+            });
         }
     }
 }
@@ -14288,9 +14933,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarker2AMD]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14298,8 +14944,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarker2AMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, record_obj);
+            });
         }
     }
     {
@@ -14309,8 +14957,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarker2AMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker, record_obj);
+            });
         }
     }
 }
@@ -14361,8 +15011,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14370,8 +15022,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, record_obj);
+            });
         }
     }
     {
@@ -14381,8 +15035,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, cons
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo, record_obj);
+            });
         }
     }
 }
@@ -14396,8 +15052,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14405,8 +15063,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, record_obj);
+            });
         }
     }
     {
@@ -14416,8 +15076,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo, record_obj);
+            });
         }
     }
 }
@@ -14433,8 +15095,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14442,8 +15106,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            });
         }
     }
     {
@@ -14453,8 +15119,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo, record_obj);
+            });
         }
     }
 }
@@ -14470,8 +15138,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14479,8 +15149,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            });
         }
     }
     {
@@ -14490,8 +15162,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo, record_obj);
+            });
         }
     }
 }
@@ -14505,8 +15179,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14514,8 +15190,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, record_obj);
+            });
         }
     }
     {
@@ -14525,8 +15203,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo, record_obj);
+            });
         }
     }
 }
@@ -14540,8 +15220,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14549,8 +15231,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, record_obj);
+            });
         }
     }
     {
@@ -14560,8 +15244,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo, record_obj);
+            });
         }
     }
 }
@@ -14576,8 +15262,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14585,8 +15273,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirect2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, record_obj);
+            });
         }
     }
     {
@@ -14596,8 +15286,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirect2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress, record_obj);
+            });
         }
     }
 }
@@ -14734,8 +15426,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14743,8 +15437,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, record_obj);
+            });
         }
     }
     {
@@ -14754,8 +15450,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType, record_obj);
+            });
         }
     }
 }
@@ -14927,8 +15625,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -14936,8 +15636,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            });
         }
     }
     {
@@ -14947,8 +15649,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            });
         }
     }
 }
@@ -15052,8 +15756,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15061,8 +15767,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, record_obj);
+            });
         }
     }
     {
@@ -15072,8 +15780,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo, record_obj);
+            });
         }
     }
 }
@@ -15087,8 +15797,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15096,8 +15808,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, record_obj);
+            });
         }
     }
     {
@@ -15107,8 +15821,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo, record_obj);
+            });
         }
     }
 }
@@ -15124,8 +15840,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSet2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15133,8 +15851,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSet2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, record_obj);
+            });
         }
     }
     {
@@ -15144,8 +15864,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSet2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo, record_obj);
+            });
         }
     }
 }
@@ -15162,9 +15884,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplate2KHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPushDescriptorSetWithTemplate2KHR(commandBuffer,
-                                                                                   pPushDescriptorSetWithTemplateInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo,
+                                                                               error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15173,9 +15897,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplate2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo,
-                                                                         record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo,
+                                                                      record_obj);
+            });
         }
     }
     {
@@ -15186,9 +15912,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplate2KHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo,
-                                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo,
+                                                                       record_obj);
+            });
         }
     }
 }
@@ -15205,9 +15933,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDescriptorBufferOffsets2EXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo,
-                                                                                error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo,
+                                                                            error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15216,8 +15946,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDescriptorBufferOffsets2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo, record_obj);
+            });
         }
     }
     {
@@ -15228,8 +15960,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDescriptorBufferOffsets2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo, record_obj);
+            });
         }
     }
 }
@@ -15246,9 +15980,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplers2EXT(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT(
-                commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer,
+                                                                                      pBindDescriptorBufferEmbeddedSamplersInfo,
+                                                                                      error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15257,9 +15994,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplers2EXT(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT(
-                commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer,
+                                                                             pBindDescriptorBufferEmbeddedSamplersInfo, record_obj);
+            });
         }
     }
     {
@@ -15270,9 +16009,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplers2EXT(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT(
-                commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer,
+                                                                              pBindDescriptorBufferEmbeddedSamplersInfo,
+                                                                              record_obj);
+            });
         }
     }
 }
@@ -15484,8 +16226,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15493,8 +16237,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     {
@@ -15504,8 +16250,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
 }
@@ -15519,8 +16267,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15528,8 +16278,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -15539,8 +16291,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -15554,8 +16308,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15563,8 +16319,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     {
@@ -15574,8 +16332,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
 }
@@ -15593,9 +16353,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount,
-                                                                                 pBuffers, pOffsets, pSizes, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers,
+                                                                             pOffsets, pSizes, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15604,9 +16366,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers,
-                                                                       pOffsets, pSizes, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
+                                                                    pSizes, record_obj);
+            });
         }
     }
     {
@@ -15617,9 +16381,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers,
-                                                                        pOffsets, pSizes, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
+                                                                     pSizes, record_obj);
+            });
         }
     }
 }
@@ -15637,9 +16403,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                                           pCounterBuffers, pCounterBufferOffsets, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
+                                                                       pCounterBuffers, pCounterBufferOffsets, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15647,9 +16415,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                                 pCounterBuffers, pCounterBufferOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
+                                                              pCounterBuffers, pCounterBufferOffsets, record_obj);
+            });
         }
     }
     {
@@ -15660,9 +16430,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                                  pCounterBuffers, pCounterBufferOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
+                                                               pCounterBuffers, pCounterBufferOffsets, record_obj);
+            });
         }
     }
 }
@@ -15680,9 +16452,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                                         pCounterBuffers, pCounterBufferOffsets, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
+                                                                     pCounterBuffers, pCounterBufferOffsets, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15690,9 +16464,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                               pCounterBuffers, pCounterBufferOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                                            pCounterBufferOffsets, record_obj);
+            });
         }
     }
     {
@@ -15703,9 +16479,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
-                                                                pCounterBuffers, pCounterBufferOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount,
+                                                             pCounterBuffers, pCounterBufferOffsets, record_obj);
+            });
         }
     }
 }
@@ -15720,8 +16498,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15729,8 +16509,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, record_obj);
+            });
         }
     }
     {
@@ -15740,8 +16522,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index, record_obj);
+            });
         }
     }
 }
@@ -15756,8 +16540,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15765,8 +16551,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, record_obj);
+            });
         }
     }
     {
@@ -15776,8 +16564,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index, record_obj);
+            });
         }
     }
 }
@@ -15796,10 +16586,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
                                                                       counterBufferOffset, counterOffset, vertexStride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15807,9 +16598,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
-                                                                counterBufferOffset, counterOffset, vertexStride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
+                                                             counterBufferOffset, counterOffset, vertexStride, record_obj);
+            });
         }
     }
     {
@@ -15820,9 +16613,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
-                                                                 counterBufferOffset, counterOffset, vertexStride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer,
+                                                              counterBufferOffset, counterOffset, vertexStride, record_obj);
+            });
         }
     }
 }
@@ -15985,8 +16780,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCuLaunchKernelNVX]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -15994,8 +16791,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCuLaunchKernelNVX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, record_obj);
+            });
         }
     }
     {
@@ -16005,8 +16804,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, c
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCuLaunchKernelNVX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo, record_obj);
+            });
         }
     }
 }
@@ -16098,9 +16899,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                      maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                  maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16108,9 +16911,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                            maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                         maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -16120,9 +16925,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                             maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                          maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -16140,9 +16947,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer,
-                                                                             countBufferOffset, maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer,
+                                                                         countBufferOffset, maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16150,9 +16959,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                   maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -16162,9 +16973,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                    maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                 maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -16392,8 +17205,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16401,8 +17216,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, record_obj);
+            });
         }
     }
     {
@@ -16413,8 +17230,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin, record_obj);
+            });
         }
     }
 }
@@ -16430,8 +17249,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16439,8 +17260,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -16450,8 +17273,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -16467,9 +17292,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount,
-                                                                       pViewportWScalings, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
+                                                                   error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16477,9 +17304,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
-                                                             record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
+                                                          record_obj);
+            });
         }
     }
     {
@@ -16489,9 +17318,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
-                                                              record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
+                                                           record_obj);
+            });
         }
     }
 }
@@ -16923,9 +17754,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
-                                                                        pDiscardRectangles, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
+                                                                    pDiscardRectangles, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16933,9 +17766,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
-                                                              pDiscardRectangles, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
+                                                           pDiscardRectangles, record_obj);
+            });
         }
     }
     {
@@ -16945,9 +17780,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
-                                                               pDiscardRectangles, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
+                                                            pDiscardRectangles, record_obj);
+            });
         }
     }
 }
@@ -16963,8 +17800,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -16972,8 +17811,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, record_obj);
+            });
         }
     }
     {
@@ -16984,8 +17825,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable, record_obj);
+            });
         }
     }
 }
@@ -17002,8 +17845,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17011,8 +17856,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, record_obj);
+            });
         }
     }
     {
@@ -17022,8 +17869,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode, record_obj);
+            });
         }
     }
 }
@@ -17347,8 +18196,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17356,8 +18207,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            });
         }
     }
     {
@@ -17367,8 +18220,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            });
         }
     }
 }
@@ -17383,8 +18238,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17392,8 +18249,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -17403,8 +18262,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -17420,8 +18281,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17429,8 +18292,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            });
         }
     }
     {
@@ -17440,8 +18305,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
+            });
         }
     }
 }
@@ -17802,8 +18669,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer c
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInitializeGraphScratchMemoryAMDX]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17812,8 +18681,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer c
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInitializeGraphScratchMemoryAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, record_obj);
+            });
         }
     }
     {
@@ -17824,8 +18695,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer c
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInitializeGraphScratchMemoryAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch, record_obj);
+            });
         }
     }
 }
@@ -17840,8 +18713,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchGraphAMDX]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17849,8 +18724,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchGraphAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            });
         }
     }
     {
@@ -17860,8 +18737,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchGraphAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            });
         }
     }
 }
@@ -17878,8 +18757,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchGraphIndirectAMDX]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17887,8 +18768,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchGraphIndirectAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            });
         }
     }
     {
@@ -17898,8 +18781,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchGraphIndirectAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo, record_obj);
+            });
         }
     }
 }
@@ -17916,8 +18801,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchGraphIndirectCountAMDX]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17926,8 +18813,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchGraphIndirectCountAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, record_obj);
+            });
         }
     }
     {
@@ -17938,8 +18827,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer com
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchGraphIndirectCountAMDX]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo, record_obj);
+            });
         }
     }
 }
@@ -17956,8 +18847,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -17965,8 +18858,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, record_obj);
+            });
         }
     }
     {
@@ -17976,8 +18871,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo, record_obj);
+            });
         }
     }
 }
@@ -18075,8 +18972,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18084,8 +18983,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, record_obj);
+            });
         }
     }
     {
@@ -18095,8 +18996,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout, record_obj);
+            });
         }
     }
 }
@@ -18114,9 +19017,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
-                                                                                 pShadingRatePalettes, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
+                                                                             pShadingRatePalettes, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18125,9 +19030,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
-                                                                       pShadingRatePalettes, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
+                                                                    pShadingRatePalettes, record_obj);
+            });
         }
     }
     {
@@ -18138,9 +19045,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(VkCommandBuffer co
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
-                                                                        pShadingRatePalettes, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount,
+                                                                     pShadingRatePalettes, record_obj);
+            });
         }
     }
 }
@@ -18157,9 +19066,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
-                                                                        pCustomSampleOrders, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
+                                                                    pCustomSampleOrders, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18167,9 +19078,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
-                                                              pCustomSampleOrders, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
+                                                           pCustomSampleOrders, record_obj);
+            });
         }
     }
     {
@@ -18179,9 +19092,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
-                                                               pCustomSampleOrders, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount,
+                                                            pCustomSampleOrders, record_obj);
+            });
         }
     }
 }
@@ -18366,9 +19281,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset,
-                                                                              update, dst, src, scratch, scratchOffset, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset,
+                                                                          update, dst, src, scratch, scratchOffset, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18376,9 +19293,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst,
-                                                                    src, scratch, scratchOffset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst,
+                                                                 src, scratch, scratchOffset, record_obj);
+            });
         }
     }
     {
@@ -18390,9 +19309,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update,
-                                                                     dst, src, scratch, scratchOffset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst,
+                                                                  src, scratch, scratchOffset, record_obj);
+            });
         }
     }
 }
@@ -18409,8 +19330,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18418,8 +19341,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, record_obj);
+            });
         }
     }
     {
@@ -18429,8 +19354,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode, record_obj);
+            });
         }
     }
 }
@@ -18450,12 +19377,15 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdTraceRaysNV(
-                commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer,
-                missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset,
-                hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride,
-                width, height, depth, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                                                         missShaderBindingTableBuffer, missShaderBindingOffset,
+                                                         missShaderBindingStride, hitShaderBindingTableBuffer,
+                                                         hitShaderBindingOffset, hitShaderBindingStride,
+                                                         callableShaderBindingTableBuffer, callableShaderBindingOffset,
+                                                         callableShaderBindingStride, width, height, depth, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18463,12 +19393,14 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
-                                                   missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
-                                                   hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
-                                                   callableShaderBindingTableBuffer, callableShaderBindingOffset,
-                                                   callableShaderBindingStride, width, height, depth, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                                                missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
+                                                hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
+                                                callableShaderBindingTableBuffer, callableShaderBindingOffset,
+                                                callableShaderBindingStride, width, height, depth, record_obj);
+            });
         }
     }
     {
@@ -18482,12 +19414,14 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
-                                                    missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
-                                                    hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
-                                                    callableShaderBindingTableBuffer, callableShaderBindingOffset,
-                                                    callableShaderBindingStride, width, height, depth, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                                                 missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
+                                                 hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
+                                                 callableShaderBindingTableBuffer, callableShaderBindingOffset,
+                                                 callableShaderBindingStride, width, height, depth, record_obj);
+            });
         }
     }
 }
@@ -18640,9 +19574,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                                                     pAccelerationStructures, queryType, queryPool,
+                                                                                     firstQuery, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18651,9 +19588,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                                            pAccelerationStructures, queryType, queryPool,
+                                                                            firstQuery, record_obj);
+            });
         }
     }
     {
@@ -18665,9 +19605,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                                             pAccelerationStructures, queryType, queryPool,
+                                                                             firstQuery, record_obj);
+            });
         }
     }
 }
@@ -18766,9 +19709,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker,
-                                                                      error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker,
+                                                                  error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18776,8 +19721,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
+            });
         }
     }
     {
@@ -18787,9 +19734,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker,
-                                                             record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
+            });
         }
     }
 }
@@ -18891,8 +19839,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18900,8 +19850,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, record_obj);
+            });
         }
     }
     {
@@ -18911,8 +19863,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uin
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, record_obj);
+            });
         }
     }
 }
@@ -18929,9 +19883,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18939,8 +19894,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -18950,8 +19907,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -18969,9 +19928,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer,
-                                                                              countBufferOffset, maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer,
+                                                                          countBufferOffset, maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -18979,9 +19940,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                    maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                 maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -18993,9 +19956,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                     maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                  maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -19013,9 +19978,12 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetExclusiveScissorEnableNV(
-                commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor,
+                                                                         exclusiveScissorCount, pExclusiveScissorEnables,
+                                                                         error_obj);
+            });
             if (skip) return;
         }
     }
@@ -19023,9 +19991,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
-                                                                   pExclusiveScissorEnables, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                                pExclusiveScissorEnables, record_obj);
+            });
         }
     }
     {
@@ -19036,9 +20006,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
-                                                                    pExclusiveScissorEnables, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                                 pExclusiveScissorEnables, record_obj);
+            });
         }
     }
 }
@@ -19054,9 +20026,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
-                                                                       pExclusiveScissors, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                                   pExclusiveScissors, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -19064,9 +20038,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
-                                                             pExclusiveScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                          pExclusiveScissors, record_obj);
+            });
         }
     }
     {
@@ -19076,9 +20052,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
-                                                              pExclusiveScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                           pExclusiveScissors, record_obj);
+            });
         }
     }
 }
@@ -19092,8 +20070,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -19101,8 +20081,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, record_obj);
+            });
         }
     }
     {
@@ -19112,8 +20094,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker, record_obj);
+            });
         }
     }
 }
@@ -19244,8 +20228,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, error_obj);
+            });
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -19253,8 +20239,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer comm
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     VkResult result;
@@ -19266,8 +20254,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer comm
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     return result;
@@ -19285,8 +20275,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, error_obj);
+            });
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -19295,8 +20287,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffe
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     VkResult result;
@@ -19309,8 +20303,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffe
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, record_obj);
+            });
         }
     }
     return result;
@@ -19328,8 +20324,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, error_obj);
+            });
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -19337,8 +20335,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(VkCommandBuffer co
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, record_obj);
+            });
         }
     }
     VkResult result;
@@ -19350,8 +20350,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(VkCommandBuffer co
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, record_obj);
+            });
         }
     }
     return result;
@@ -19989,8 +20991,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -19998,8 +21002,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            });
         }
     }
     {
@@ -20009,8 +21015,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern, record_obj);
+            });
         }
     }
 }
@@ -20059,8 +21067,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCu
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20068,8 +21078,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode, record_obj);
+            });
         }
     }
     {
@@ -20079,8 +21091,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode, record_obj);
+            });
         }
     }
 }
@@ -20094,8 +21108,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkF
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20103,8 +21119,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkF
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace, record_obj);
+            });
         }
     }
     {
@@ -20114,8 +21132,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkF
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace, record_obj);
+            });
         }
     }
 }
@@ -20131,8 +21151,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20140,8 +21162,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, record_obj);
+            });
         }
     }
     {
@@ -20151,8 +21175,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology, record_obj);
+            });
         }
     }
 }
@@ -20169,8 +21195,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20178,8 +21206,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, record_obj);
+            });
         }
     }
     {
@@ -20189,8 +21219,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports, record_obj);
+            });
         }
     }
 }
@@ -20206,8 +21238,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20215,8 +21249,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, record_obj);
+            });
         }
     }
     {
@@ -20226,8 +21262,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, record_obj);
+            });
         }
     }
 }
@@ -20244,9 +21282,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers,
-                                                                       pOffsets, pSizes, pStrides, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets,
+                                                                   pSizes, pStrides, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20254,9 +21294,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
-                                                             pStrides, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
+                                                          pStrides, record_obj);
+            });
         }
     }
     {
@@ -20266,9 +21308,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
-                                                              pStrides, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes,
+                                                           pStrides, record_obj);
+            });
         }
     }
 }
@@ -20283,8 +21327,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20292,8 +21338,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, record_obj);
+            });
         }
     }
     {
@@ -20303,8 +21351,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable, record_obj);
+            });
         }
     }
 }
@@ -20319,8 +21369,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20328,8 +21380,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, record_obj);
+            });
         }
     }
     {
@@ -20339,8 +21393,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable, record_obj);
+            });
         }
     }
 }
@@ -20354,8 +21410,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20363,8 +21421,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, record_obj);
+            });
         }
     }
     {
@@ -20374,8 +21434,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp, record_obj);
+            });
         }
     }
 }
@@ -20391,8 +21453,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20400,8 +21464,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, record_obj);
+            });
         }
     }
     {
@@ -20411,8 +21477,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable, record_obj);
+            });
         }
     }
 }
@@ -20428,8 +21496,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20437,8 +21507,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, record_obj);
+            });
         }
     }
     {
@@ -20448,8 +21520,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable, record_obj);
+            });
         }
     }
 }
@@ -20464,9 +21538,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkS
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp,
-                                                                 error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp,
+                                                             error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20474,8 +21550,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkS
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            });
         }
     }
     {
@@ -20485,9 +21563,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkS
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp,
-                                                        record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp, record_obj);
+            });
         }
     }
 }
@@ -20776,8 +21855,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20786,8 +21867,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, record_obj);
+            });
         }
     }
     {
@@ -20798,8 +21881,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer comm
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo, record_obj);
+            });
         }
     }
 }
@@ -20816,9 +21901,11 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo,
-                                                                            error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo,
+                                                                        error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20826,9 +21913,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo,
-                                                                  record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo, record_obj);
+            });
         }
     }
     {
@@ -20838,9 +21926,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo,
-                                                                   record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo, record_obj);
+            });
         }
     }
 }
@@ -20857,9 +21946,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex,
-                                                                           error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex,
+                                                                       error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20867,9 +21958,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex,
-                                                                 record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex, record_obj);
+            });
         }
     }
     {
@@ -20879,9 +21971,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex,
-                                                                  record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex, record_obj);
+            });
         }
     }
 }
@@ -20979,8 +22072,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias2EXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -20988,8 +22083,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, record_obj);
+            });
         }
     }
     {
@@ -20999,8 +22096,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, co
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias2EXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo, record_obj);
+            });
         }
     }
 }
@@ -21433,8 +22532,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCudaLaunchKernelNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -21442,8 +22543,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCudaLaunchKernelNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, record_obj);
+            });
         }
     }
     {
@@ -21453,8 +22556,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCudaLaunchKernelNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo, record_obj);
+            });
         }
     }
 }
@@ -21620,8 +22725,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBuffersEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -21629,8 +22736,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorBuffersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj);
+            });
         }
     }
     {
@@ -21640,8 +22749,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorBuffersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj);
+            });
         }
     }
 }
@@ -21659,9 +22770,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDescriptorBufferOffsetsEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet,
-                                                                               setCount, pBufferIndices, pOffsets, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet,
+                                                                           setCount, pBufferIndices, pOffsets, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -21670,9 +22783,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDescriptorBufferOffsetsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
-                                                                     pBufferIndices, pOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                                                  pBufferIndices, pOffsets, record_obj);
+            });
         }
     }
     {
@@ -21684,9 +22799,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDescriptorBufferOffsetsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
-                                                                      pBufferIndices, pOffsets, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                                                   pBufferIndices, pOffsets, record_obj);
+            });
         }
     }
 }
@@ -21704,9 +22821,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout,
-                                                                                         set, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set,
+                                                                                     error_obj);
+            });
             if (skip) return;
         }
     }
@@ -21715,9 +22834,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandB
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set,
-                                                                               record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set,
+                                                                            record_obj);
+            });
         }
     }
     {
@@ -21728,9 +22849,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandB
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set,
-                                                                                record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set,
+                                                                             record_obj);
+            });
         }
     }
 }
@@ -21965,8 +23088,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -21974,8 +23099,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateEnumNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, record_obj);
+            });
         }
     }
     {
@@ -21986,8 +23113,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps, record_obj);
+            });
         }
     }
 }
@@ -22213,10 +23342,12 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetVertexInputEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount,
-                                                                   pVertexBindingDescriptions, vertexAttributeDescriptionCount,
-                                                                   pVertexAttributeDescriptions, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount,
+                                                               pVertexBindingDescriptions, vertexAttributeDescriptionCount,
+                                                               pVertexAttributeDescriptions, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22224,9 +23355,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetVertexInputEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
-                                                         vertexAttributeDescriptionCount, pVertexAttributeDescriptions, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
+                                                      vertexAttributeDescriptionCount, pVertexAttributeDescriptions, record_obj);
+            });
         }
     }
     {
@@ -22237,10 +23370,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetVertexInputEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
-                                                          vertexAttributeDescriptionCount, pVertexAttributeDescriptions,
-                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
+                                                       vertexAttributeDescriptionCount, pVertexAttributeDescriptions, record_obj);
+            });
         }
     }
 }
@@ -22689,8 +23823,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSubpassShadingHUAWEI]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSubpassShadingHUAWEI(commandBuffer, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSubpassShadingHUAWEI(commandBuffer, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22698,8 +23834,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSubpassShadingHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSubpassShadingHUAWEI(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSubpassShadingHUAWEI(commandBuffer, record_obj);
+            });
         }
     }
     {
@@ -22709,8 +23847,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSubpassShadingHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSubpassShadingHUAWEI(commandBuffer, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSubpassShadingHUAWEI(commandBuffer, record_obj);
+            });
         }
     }
 }
@@ -22727,8 +23867,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindInvocationMaskHUAWEI]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22736,8 +23878,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindInvocationMaskHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, record_obj);
+            });
         }
     }
     {
@@ -22747,8 +23891,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindInvocationMaskHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout, record_obj);
+            });
         }
     }
 }
@@ -22845,8 +23991,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPatchControlPointsEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22854,8 +24002,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPatchControlPointsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, record_obj);
+            });
         }
     }
     {
@@ -22865,8 +24015,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPatchControlPointsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints, record_obj);
+            });
         }
     }
 }
@@ -22882,8 +24034,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22892,8 +24046,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, record_obj);
+            });
         }
     }
     {
@@ -22904,8 +24060,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable, record_obj);
+            });
         }
     }
 }
@@ -22920,8 +24078,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22929,8 +24089,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, record_obj);
+            });
         }
     }
     {
@@ -22940,8 +24102,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable, record_obj);
+            });
         }
     }
 }
@@ -22955,8 +24119,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLog
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLogicOpEXT(commandBuffer, logicOp, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLogicOpEXT(commandBuffer, logicOp, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -22964,8 +24130,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLog
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLogicOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp, record_obj);
+            });
         }
     }
     {
@@ -22975,8 +24143,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLog
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLogicOpEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp, record_obj);
+            });
         }
     }
 }
@@ -22992,8 +24162,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23001,8 +24173,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, record_obj);
+            });
         }
     }
     {
@@ -23013,8 +24187,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable, record_obj);
+            });
         }
     }
 }
@@ -23114,9 +24290,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23124,8 +24301,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorWriteEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, record_obj);
+            });
         }
     }
     {
@@ -23135,8 +24314,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorWriteEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables, record_obj);
+            });
         }
     }
 }
@@ -23151,9 +24332,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance,
-                                                              stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance,
+                                                          stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23161,9 +24344,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride,
-                                                    record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride,
+                                                 record_obj);
+            });
         }
     }
     {
@@ -23173,9 +24358,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride,
-                                                     record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride,
+                                                  record_obj);
+            });
         }
     }
 }
@@ -23191,9 +24378,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiIndexedEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount,
-                                                                     firstInstance, stride, pVertexOffset, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount,
+                                                                 firstInstance, stride, pVertexOffset, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23201,9 +24390,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance,
-                                                           stride, pVertexOffset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride,
+                                                        pVertexOffset, record_obj);
+            });
         }
     }
     {
@@ -23213,9 +24404,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiIndexedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance,
-                                                            stride, pVertexOffset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance,
+                                                         stride, pVertexOffset, record_obj);
+            });
         }
     }
 }
@@ -23304,8 +24497,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildMicromapsEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23313,8 +24508,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildMicromapsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, record_obj);
+            });
         }
     }
     {
@@ -23324,8 +24521,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildMicromapsEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos, record_obj);
+            });
         }
     }
 }
@@ -23538,8 +24737,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyMicromapEXT(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMicromapEXT(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23547,8 +24748,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMicromapEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -23558,8 +24761,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, con
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMicromapEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -23575,8 +24780,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapToMemoryEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23584,8 +24791,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMicromapToMemoryEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -23595,8 +24804,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMicromapToMemoryEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -23612,8 +24823,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToMicromapEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23621,8 +24834,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToMicromapEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -23632,8 +24847,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToMicromapEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -23651,9 +24868,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteMicromapsPropertiesEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType,
-                                                                             queryPool, firstQuery, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType,
+                                                                         queryPool, firstQuery, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23661,9 +24880,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteMicromapsPropertiesEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool,
-                                                                   firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool,
+                                                                firstQuery, record_obj);
+            });
         }
     }
     {
@@ -23673,9 +24894,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteMicromapsPropertiesEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool,
-                                                                    firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool,
+                                                                 firstQuery, record_obj);
+            });
         }
     }
 }
@@ -23767,8 +24990,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawClusterHUAWEI]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23776,8 +25001,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawClusterHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
     {
@@ -23787,8 +25014,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, u
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawClusterHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
 }
@@ -23804,8 +25033,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawClusterIndirectHUAWEI]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23813,8 +25044,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawClusterIndirectHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, record_obj);
+            });
         }
     }
     {
@@ -23824,8 +25057,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawClusterIndirectHUAWEI]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset, record_obj);
+            });
         }
     }
 }
@@ -23957,9 +25192,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryIndirectNV]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -23967,8 +25203,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, record_obj);
+            });
         }
     }
     {
@@ -23978,8 +25216,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, record_obj);
+            });
         }
     }
 }
@@ -23998,9 +25238,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToImageIndirectNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyMemoryToImageIndirectNV(
-                commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride,
+                                                                         dstImage, dstImageLayout, pImageSubresources, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24008,9 +25250,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToImageIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage,
-                                                                   dstImageLayout, pImageSubresources, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage,
+                                                                dstImageLayout, pImageSubresources, record_obj);
+            });
         }
     }
     {
@@ -24021,9 +25265,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToImageIndirectNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage,
-                                                                    dstImageLayout, pImageSubresources, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage,
+                                                                 dstImageLayout, pImageSubresources, record_obj);
+            });
         }
     }
 }
@@ -24038,9 +25284,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions,
-                                                                    error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions,
+                                                                error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24048,9 +25296,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecompressMemoryNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions,
-                                                          record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions, record_obj);
+            });
         }
     }
     {
@@ -24060,9 +25309,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecompressMemoryNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions,
-                                                           record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions, record_obj);
+            });
         }
     }
 }
@@ -24080,9 +25330,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryIndirectCountNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
-                                                                                 indirectCommandsCountAddress, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
+                                                                             indirectCommandsCountAddress, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24091,9 +25343,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecompressMemoryIndirectCountNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
-                                                                       indirectCommandsCountAddress, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
+                                                                    indirectCommandsCountAddress, stride, record_obj);
+            });
         }
     }
     {
@@ -24104,9 +25358,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecompressMemoryIndirectCountNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
-                                                                        indirectCommandsCountAddress, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress,
+                                                                     indirectCommandsCountAddress, stride, record_obj);
+            });
         }
     }
 }
@@ -24163,9 +25419,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdatePipelineIndirectBufferNV]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24174,8 +25431,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdatePipelineIndirectBufferNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            });
         }
     }
     {
@@ -24186,8 +25445,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer com
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdatePipelineIndirectBufferNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+            });
         }
     }
 }
@@ -24244,8 +25505,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClampEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24253,8 +25516,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClampEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, record_obj);
+            });
         }
     }
     {
@@ -24264,8 +25529,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClampEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable, record_obj);
+            });
         }
     }
 }
@@ -24279,8 +25546,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPolygonModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetPolygonModeEXT(commandBuffer, polygonMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetPolygonModeEXT(commandBuffer, polygonMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24288,8 +25557,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPolygonModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode, record_obj);
+            });
         }
     }
     {
@@ -24299,8 +25570,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, V
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPolygonModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode, record_obj);
+            });
         }
     }
 }
@@ -24317,8 +25590,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizationSamplesEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24326,8 +25601,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizationSamplesEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, record_obj);
+            });
         }
     }
     {
@@ -24337,8 +25614,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizationSamplesEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples, record_obj);
+            });
         }
     }
 }
@@ -24353,8 +25632,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleMaskEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24362,8 +25643,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleMaskEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, record_obj);
+            });
         }
     }
     {
@@ -24373,8 +25656,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, Vk
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleMaskEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask, record_obj);
+            });
         }
     }
 }
@@ -24390,8 +25675,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToCoverageEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24399,8 +25686,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetAlphaToCoverageEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, record_obj);
+            });
         }
     }
     {
@@ -24410,8 +25699,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetAlphaToCoverageEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable, record_obj);
+            });
         }
     }
 }
@@ -24426,8 +25717,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToOneEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24435,8 +25728,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetAlphaToOneEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, record_obj);
+            });
         }
     }
     {
@@ -24446,8 +25741,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetAlphaToOneEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable, record_obj);
+            });
         }
     }
 }
@@ -24461,8 +25758,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24470,8 +25769,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLogicOpEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, record_obj);
+            });
         }
     }
     {
@@ -24481,8 +25782,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLogicOpEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable, record_obj);
+            });
         }
     }
 }
@@ -24498,9 +25801,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                        pColorBlendEnables, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount,
+                                                                    pColorBlendEnables, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24508,9 +25813,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables,
-                                                              record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables,
+                                                           record_obj);
+            });
         }
     }
     {
@@ -24520,9 +25827,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuff
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables,
-                                                               record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables,
+                                                            record_obj);
+            });
         }
     }
 }
@@ -24540,9 +25849,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEquationEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                          pColorBlendEquations, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount,
+                                                                      pColorBlendEquations, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24550,9 +25861,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendEquationEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                pColorBlendEquations, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations,
+                                                             record_obj);
+            });
         }
     }
     {
@@ -24562,9 +25875,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendEquationEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                 pColorBlendEquations, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount,
+                                                              pColorBlendEquations, record_obj);
+            });
         }
     }
 }
@@ -24579,9 +25894,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteMaskEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                      pColorWriteMasks, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount,
+                                                                  pColorWriteMasks, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24589,9 +25906,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorWriteMaskEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks,
-                                                            record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks,
+                                                         record_obj);
+            });
         }
     }
     {
@@ -24601,9 +25920,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorWriteMaskEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks,
-                                                             record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks,
+                                                          record_obj);
+            });
         }
     }
 }
@@ -24620,8 +25941,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetTessellationDomainOriginEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24630,8 +25953,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer com
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetTessellationDomainOriginEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, record_obj);
+            });
         }
     }
     {
@@ -24642,8 +25967,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer com
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetTessellationDomainOriginEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin, record_obj);
+            });
         }
     }
 }
@@ -24659,8 +25986,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizationStreamEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24668,8 +25997,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizationStreamEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, record_obj);
+            });
         }
     }
     {
@@ -24679,8 +26010,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizationStreamEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream, record_obj);
+            });
         }
     }
 }
@@ -24697,9 +26030,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetConservativeRasterizationModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode,
-                                                                                     error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode,
+                                                                                 error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24708,9 +26043,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetConservativeRasterizationModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode,
-                                                                           record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode, record_obj);
+            });
         }
     }
     {
@@ -24721,9 +26057,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetConservativeRasterizationModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode,
-                                                                            record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode, record_obj);
+            });
         }
     }
 }
@@ -24740,9 +26077,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT(
-                commandBuffer, extraPrimitiveOverestimationSize, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer,
+                                                                                    extraPrimitiveOverestimationSize, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24751,9 +26090,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBu
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize,
-                                                                              record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize,
+                                                                           record_obj);
+            });
         }
     }
     {
@@ -24764,9 +26105,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBu
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize,
-                                                                               record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize,
+                                                                            record_obj);
+            });
         }
     }
 }
@@ -24781,8 +26124,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffe
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24790,8 +26135,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClipEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, record_obj);
+            });
         }
     }
     {
@@ -24801,8 +26148,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffe
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClipEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable, record_obj);
+            });
         }
     }
 }
@@ -24818,8 +26167,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24827,8 +26178,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, record_obj);
+            });
         }
     }
     {
@@ -24838,8 +26191,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable, record_obj);
+            });
         }
     }
 }
@@ -24857,9 +26212,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendAdvancedEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                          pColorBlendAdvanced, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount,
+                                                                      pColorBlendAdvanced, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24867,9 +26224,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendAdvancedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                pColorBlendAdvanced, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced,
+                                                             record_obj);
+            });
         }
     }
     {
@@ -24879,9 +26238,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendAdvancedEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount,
-                                                                 pColorBlendAdvanced, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced,
+                                                              record_obj);
+            });
         }
     }
 }
@@ -24898,8 +26259,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandB
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetProvokingVertexModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24907,8 +26270,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetProvokingVertexModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, record_obj);
+            });
         }
     }
     {
@@ -24918,8 +26283,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandB
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetProvokingVertexModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode, record_obj);
+            });
         }
     }
 }
@@ -24936,8 +26303,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineRasterizationModeEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24945,8 +26314,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineRasterizationModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, record_obj);
+            });
         }
     }
     {
@@ -24956,8 +26327,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineRasterizationModeEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode, record_obj);
+            });
         }
     }
 }
@@ -24973,8 +26346,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -24982,8 +26357,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, record_obj);
+            });
         }
     }
     {
@@ -24993,8 +26370,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuf
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable, record_obj);
+            });
         }
     }
 }
@@ -25010,8 +26389,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipNegativeOneToOneEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25020,8 +26401,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClipNegativeOneToOneEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, record_obj);
+            });
         }
     }
     {
@@ -25032,8 +26415,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer co
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClipNegativeOneToOneEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne, record_obj);
+            });
         }
     }
 }
@@ -25049,8 +26434,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25058,8 +26445,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, record_obj);
+            });
         }
     }
     {
@@ -25069,8 +26458,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable, record_obj);
+            });
         }
     }
 }
@@ -25085,9 +26476,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportSwizzleNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount,
-                                                                      pViewportSwizzles, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles,
+                                                                  error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25095,9 +26488,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportSwizzleNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles,
-                                                            record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles,
+                                                         record_obj);
+            });
         }
     }
     {
@@ -25107,9 +26502,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportSwizzleNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles,
-                                                             record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles,
+                                                          record_obj);
+            });
         }
     }
 }
@@ -25125,8 +26522,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageToColorEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25134,8 +26533,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageToColorEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, record_obj);
+            });
         }
     }
     {
@@ -25145,8 +26546,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageToColorEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable, record_obj);
+            });
         }
     }
 }
@@ -25162,8 +26565,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageToColorLocationNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25171,8 +26576,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageToColorLocationNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, record_obj);
+            });
         }
     }
     {
@@ -25183,8 +26590,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageToColorLocationNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation, record_obj);
+            });
         }
     }
 }
@@ -25201,8 +26610,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationModeNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25210,8 +26621,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationModeNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, record_obj);
+            });
         }
     }
     {
@@ -25221,8 +26634,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationModeNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode, record_obj);
+            });
         }
     }
 }
@@ -25239,9 +26654,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationTableEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable,
-                                                                                    error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable,
+                                                                                error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25250,8 +26667,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationTableEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable, record_obj);
+            });
         }
     }
     {
@@ -25262,9 +26681,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationTableEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable,
-                                                                           record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable, record_obj);
+            });
         }
     }
 }
@@ -25281,9 +26701,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationTableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
-                                                                              pCoverageModulationTable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
+                                                                          pCoverageModulationTable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25291,9 +26713,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationTableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
-                                                                    pCoverageModulationTable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
+                                                                 pCoverageModulationTable, record_obj);
+            });
         }
     }
     {
@@ -25304,9 +26728,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationTableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
-                                                                     pCoverageModulationTable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount,
+                                                                  pCoverageModulationTable, record_obj);
+            });
         }
     }
 }
@@ -25322,8 +26748,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer comman
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetShadingRateImageEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25331,8 +26759,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetShadingRateImageEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, record_obj);
+            });
         }
     }
     {
@@ -25342,8 +26772,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer comman
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetShadingRateImageEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable, record_obj);
+            });
         }
     }
 }
@@ -25360,9 +26792,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuf
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRepresentativeFragmentTestEnableNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRepresentativeFragmentTestEnableNV(commandBuffer,
-                                                                                       representativeFragmentTestEnable, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable,
+                                                                                   error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25371,9 +26805,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuf
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRepresentativeFragmentTestEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable,
-                                                                             record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable,
+                                                                          record_obj);
+            });
         }
     }
     {
@@ -25384,9 +26820,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuf
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRepresentativeFragmentTestEnableNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable,
-                                                                              record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable,
+                                                                           record_obj);
+            });
         }
     }
 }
@@ -25403,8 +26841,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer command
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageReductionModeNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25412,8 +26852,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageReductionModeNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, record_obj);
+            });
         }
     }
     {
@@ -25423,8 +26865,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer command
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageReductionModeNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode, record_obj);
+            });
         }
     }
 }
@@ -25679,8 +27123,10 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdOpticalFlowExecuteNV]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25688,8 +27134,10 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdOpticalFlowExecuteNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, record_obj);
+            });
         }
     }
     {
@@ -25699,8 +27147,10 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdOpticalFlowExecuteNV]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo, record_obj);
+            });
         }
     }
 }
@@ -25823,8 +27273,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadersEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -25832,8 +27284,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, record_obj);
+            });
         }
     }
     {
@@ -25843,8 +27297,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadersEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders, record_obj);
+            });
         }
     }
 }
@@ -26131,8 +27587,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26141,8 +27599,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetAttachmentFeedbackLoopEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, record_obj);
+            });
         }
     }
     {
@@ -26153,8 +27613,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask, record_obj);
+            });
         }
     }
 }
@@ -26297,9 +27759,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
-                                                                                error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
+                                                                            error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26308,9 +27772,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
-                                                                      record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos, record_obj);
+            });
         }
     }
     {
@@ -26321,9 +27786,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
-                                                                       record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
+                                                                    record_obj);
+            });
         }
     }
 }
@@ -26343,9 +27810,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(VkCommandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(
-                commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos,
+                                                                                    pIndirectDeviceAddresses, pIndirectStrides,
+                                                                                    ppMaxPrimitiveCounts, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26354,9 +27824,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(VkCommandBu
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdBuildAccelerationStructuresIndirectKHR(
-                commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos,
+                                                                           pIndirectDeviceAddresses, pIndirectStrides,
+                                                                           ppMaxPrimitiveCounts, record_obj);
+            });
         }
     }
     {
@@ -26368,9 +27841,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(VkCommandBu
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(
-                commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos,
+                                                                            pIndirectDeviceAddresses, pIndirectStrides,
+                                                                            ppMaxPrimitiveCounts, record_obj);
+            });
         }
     }
 }
@@ -26605,8 +28081,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer comma
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26614,8 +28092,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer comma
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -26626,8 +28106,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer comma
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -26644,8 +28126,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26654,8 +28138,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuff
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -26666,8 +28152,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuff
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -26684,8 +28172,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuff
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26694,8 +28184,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuff
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
     {
@@ -26706,8 +28198,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuff
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo, record_obj);
+            });
         }
     }
 }
@@ -26770,9 +28264,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(VkCommand
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                                                      pAccelerationStructures, queryType,
+                                                                                      queryPool, firstQuery, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26781,9 +28278,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(VkCommand
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                                             pAccelerationStructures, queryType, queryPool,
+                                                                             firstQuery, record_obj);
+            });
         }
     }
     {
@@ -26795,9 +28295,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(VkCommand
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(
-                commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                                              pAccelerationStructures, queryType, queryPool,
+                                                                              firstQuery, record_obj);
+            });
         }
     }
 }
@@ -26904,10 +28407,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
-                                                              pHitShaderBindingTable, pCallableShaderBindingTable, width, height,
-                                                              depth, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                                          pHitShaderBindingTable, pCallableShaderBindingTable, width, height,
+                                                          depth, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -26915,10 +28420,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
-                                                    pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth,
-                                                    record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                                 pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth,
+                                                 record_obj);
+            });
         }
     }
     {
@@ -26929,10 +28436,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
-                                                     pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth,
-                                                     record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                                  pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth,
+                                                  record_obj);
+            });
         }
     }
 }
@@ -26998,10 +28507,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdTraceRaysIndirectKHR(
-                commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
-                pCallableShaderBindingTable, indirectDeviceAddress, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable,
+                                                                  pMissShaderBindingTable, pHitShaderBindingTable,
+                                                                  pCallableShaderBindingTable, indirectDeviceAddress, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -27009,10 +28520,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
-                                                            pHitShaderBindingTable, pCallableShaderBindingTable,
-                                                            indirectDeviceAddress, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                                         pHitShaderBindingTable, pCallableShaderBindingTable,
+                                                         indirectDeviceAddress, record_obj);
+            });
         }
     }
     {
@@ -27023,10 +28536,12 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
-                                                             pHitShaderBindingTable, pCallableShaderBindingTable,
-                                                             indirectDeviceAddress, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                                          pHitShaderBindingTable, pCallableShaderBindingTable,
+                                                          indirectDeviceAddress, record_obj);
+            });
         }
     }
 }
@@ -27083,8 +28598,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -27093,8 +28610,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, record_obj);
+            });
         }
     }
     {
@@ -27105,8 +28624,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize, record_obj);
+            });
         }
     }
 }
@@ -27121,8 +28642,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -27130,8 +28653,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
     {
@@ -27141,8 +28666,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, ui
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+            });
         }
     }
 }
@@ -27159,9 +28686,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBu
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |=
-                intercept->PreCallValidateCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -27169,8 +28697,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -27180,8 +28710,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBu
     {
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -27199,9 +28731,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallValidate");
         for (const ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountEXT]) {
-            auto lock = intercept->ReadLock();
-            skip |= intercept->PreCallValidateCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer,
-                                                                               countBufferOffset, maxDrawCount, stride, error_obj);
+            skip |= DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferReadLock();
+                return vo->PreCallValidateCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer,
+                                                                           countBufferOffset, maxDrawCount, stride, error_obj);
+            });
             if (skip) return;
         }
     }
@@ -27210,9 +28744,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PreCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PreCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                     maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PreCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                  maxDrawCount, stride, record_obj);
+            });
         }
     }
     {
@@ -27224,9 +28760,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer comm
         VVL_ZoneScopedN("PostCallRecord");
         for (ValidationObject* intercept :
              layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountEXT]) {
-            auto lock = intercept->WriteLock();
-            intercept->PostCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
-                                                                      maxDrawCount, stride, record_obj);
+            DispatchToValidationObject(intercept, [&](auto* vo) {
+                auto lock = vo->CommandBufferWriteLock();
+                vo->PostCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                                   maxDrawCount, stride, record_obj);
+            });
         }
     }
 }
@@ -45,6 +45,7 @@
 #include "vk_layer_config.h"
 #include "layer_options.h"
 #include "containers/custom_containers.h"
+#include "containers/slot_map.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
@@ -91,7 +92,14 @@ class Pipeline;
 // Each chassis layer will need to track its own state
 using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map uniqueID to actual object handle.
+// The lock-free slot map picks the unique ID itself, with the ID encoding where the handle is stored.
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+using UniqueIdMapping = vvl::concurrent_slot_map<uint64_t>;
+#else
+using UniqueIdMapping = vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>;
+#endif
+extern UniqueIdMapping unique_id_mapping;
 
 std::vector<std::pair<uint32_t, uint32_t>>& GetCustomStypeInfo();
 
@@ -2261,6 +2269,10 @@ class ValidationObject {
     mutable std::shared_mutex validation_object_mutex;
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
+    // Used by vkCmd* calls. Command buffers are externally synchronized, so validation objects that only touch
+    // the state of the command buffer being recorded while recording can avoid the device wide lock.
+    virtual ReadLockGuard CommandBufferReadLock() const { return ReadLock(); }
+    virtual WriteLockGuard CommandBufferWriteLock() { return WriteLock(); }
 
     // If the Record phase calls a function that blocks, we might need to release
     // the lock that protects Record itself in order to avoid mutual waiting.
@@ -2409,10 +2421,15 @@ class ValidationObject {
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+        const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
+        assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
+#else
         auto unique_id = global_unique_id++;
         unique_id = HashedUint64::hash(unique_id);
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
         unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+#endif
         return (HandleType)unique_id;
     }
 
@@ -44,21 +44,25 @@ class APISpecific:
                     {
                         'include': 'thread_tracker/thread_safety_validation.h',
                         'class': 'ThreadSafety',
+                        'final_object_type': 'LayerObjectTypeThreading',
                         'enabled': '!disables[thread_safety]'
                     },
                     {
                         'include': 'stateless/stateless_validation.h',
                         'class': 'StatelessValidation',
+                        'final_object_type': 'LayerObjectTypeParameterValidation',
                         'enabled': '!disables[stateless_checks]'
                     },
                     {
                         'include': 'object_tracker/object_lifetime_validation.h',
                         'class': 'ObjectLifetimes',
+                        'final_object_type': 'LayerObjectTypeObjectTracker',
                         'enabled': '!disables[object_tracking]'
                     },
                     {
                         'include': 'core_checks/core_validation.h',
                         'class': 'CoreChecks',
+                        'final_object_type': 'LayerObjectTypeCoreValidation',
                         'enabled': '!disables[core_checks]'
                     },
                     {
@@ -79,6 +83,7 @@ class APISpecific:
                     {
                         'include': 'sync/sync_validation.h',
                         'class': 'SyncValidator',
+                        'final_object_type': 'LayerObjectTypeSyncValidation',
                         'enabled': 'enables[sync_validation]'
                     }
                 ]
@@ -307,6 +312,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_layer_config.h"
             #include "layer_options.h"
             #include "containers/custom_containers.h"
+            #include "containers/slot_map.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
@@ -353,7 +359,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
             // Each chassis layer will need to track its own state
             using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-            extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            // Map uniqueID to actual object handle.
+            // The lock-free slot map picks the unique ID itself, with the ID encoding where the handle is stored.
+            #ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+            using UniqueIdMapping = vvl::concurrent_slot_map<uint64_t>;
+            #else
+            using UniqueIdMapping = vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>;
+            #endif
+            extern UniqueIdMapping unique_id_mapping;
 
             std::vector<std::pair<uint32_t, uint32_t>>& GetCustomStypeInfo();
 
@@ -456,6 +469,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 mutable std::shared_mutex validation_object_mutex;
                 virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
                 virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
+                // Used by vkCmd* calls. Command buffers are externally synchronized, so validation objects that only touch
+                // the state of the command buffer being recorded while recording can avoid the device wide lock.
+                virtual ReadLockGuard CommandBufferReadLock() const { return ReadLock(); }
+                virtual WriteLockGuard CommandBufferWriteLock() { return WriteLock(); }
 
                 // If the Record phase calls a function that blocks, we might need to release
                 // the lock that protects Record itself in order to avoid mutual waiting.
@@ -599,10 +616,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 template <typename HandleType>
                 HandleType WrapNew(HandleType new_created_handle) {
                     if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
+#ifdef VVL_LOCK_FREE_HANDLE_WRAPPING
+                    const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
+                    assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
+#else
                     auto unique_id = global_unique_id++;
                     unique_id = HashedUint64::hash(unique_id);
                     assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
                     unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+#endif
                     return (HandleType)unique_id;
                 }
 
@@ -757,7 +779,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             std::atomic<uint64_t> global_unique_id(1ULL);
             // Map uniqueID to actual object handle. Accesses to the map itself are
             // internally synchronized.
-            vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            UniqueIdMapping unique_id_mapping;
 
             // State we track in order to populate HandleData for things such as ignored pointers
             static vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
@@ -778,6 +800,32 @@ class LayerChassisOutputGenerator(BaseGenerator):
         out.append('#include "chassis_dispatch_helper.h"\n')
         out.append('\n')
 
+        # vkCmd* calls go through DispatchToValidationObject so that intercepts of final validation objects are called
+        # directly (and can be inlined) instead of through the vtable
+        final_layers = [x for x in APISpecific.getValidationLayerList(self.targetApiName) if 'final_object_type' in x]
+        out.append('''
+            template <typename Derived, typename Base>
+            using MatchConst = std::conditional_t<std::is_const_v<Base>, const Derived, Derived>;
+
+            // Command recording is the hottest path through the chassis. The most commonly enabled validation objects are
+            // final, so casting to the concrete type resolves both the lock and the intercept at compile time.
+            template <typename VO, typename Func>
+            static inline decltype(auto) DispatchToValidationObject(VO* intercept, Func&& func) {
+            ''')
+        for layer in final_layers:
+            out.append(f'    static_assert(std::is_final_v<{layer["class"]}>);\n')
+        out.append('    switch (intercept->container_type) {\n')
+        for layer in final_layers:
+            out.append(f'''        case {layer["final_object_type"]}:
+                    return func(static_cast<MatchConst<{layer["class"]}, VO>*>(intercept));
+            ''')
+        out.append('''        default:
+                    return func(intercept);
+                }
+            }
+
+            ''')
+
         out.append('// Extension exposed by the validation layer\n')
 
         instance_exts = APISpecific.getInstanceExtensionList(self.targetApiName)
@@ -2086,6 +2134,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
             # Set up skip and locking
             out.append('bool skip = false;\n')
 
+            # Command buffer recording is externally synchronized, so vkCmd* calls let each validation object decide
+            # whether it needs the device wide lock
+            is_recording_command = command.name.startswith('vkCmd')
+            read_lock = 'CommandBufferReadLock' if is_recording_command else 'ReadLock'
+            write_lock = 'CommandBufferWriteLock' if is_recording_command else 'WriteLock'
+
             out.append(f'ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));\n')
 
             # Generate pre-call validation source code
@@ -2096,8 +2150,18 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 out.append(f'    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{\n')
             else:
                 out.append('    for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
-            out.append(f'''
-                    auto lock = intercept->ReadLock();
+            if is_recording_command:
+                # vkCmd* calls are the hot path, resolve the intercepts of the final validation objects statically
+                out.append(f'''
+                        skip |= DispatchToValidationObject(intercept, [&](auto* vo) {{
+                            auto lock = vo->{read_lock}();
+                            return vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                        }});
+                        if (skip) {return_map[command.returnType]}
+                    }}\n''')
+            else:
+                out.append(f'''
+                    auto lock = intercept->{read_lock}();
                         skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
                         if (skip) {return_map[command.returnType]}
                     }}\n''')
@@ -2112,8 +2176,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 out.append(f'    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord{command.name[2:]}]) {{\n')
             else:
                 out.append('    for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
-            out.append(f'''
-                    auto lock = intercept->WriteLock();
+            if is_recording_command:
+                out.append(f'''
+                    DispatchToValidationObject(intercept, [&](auto* vo) {{
+                        auto lock = vo->{write_lock}();
+                        vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
+                    }});
+            }}\n''')
+            else:
+                out.append(f'''
+                    auto lock = intercept->{write_lock}();
                     intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
             }}\n''')
             out.append('}\n')
@@ -2182,20 +2254,28 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 'vkGetSemaphoreCounterValueKHR',
             ]
 
-            if command.name not in commands_with_blocking_operations:
-                out.append('auto lock = intercept->WriteLock();\n')
-            else:
-                out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
-
-            # Because each intercept is a copy of ValidationObject, we need to update it for each
-            if command.errorCodes and 'VK_ERROR_DEVICE_LOST' in command.errorCodes:
-                out.append('''
-                    if (result == VK_ERROR_DEVICE_LOST) {
-                        intercept->is_device_lost = true;
-                    }
+            if is_recording_command:
+                out.append(f'''
+                    DispatchToValidationObject(intercept, [&](auto* vo) {{
+                        auto lock = vo->{write_lock}();
+                        vo->PostCallRecord{command.name[2:]}({paramsList}, record_obj);
+                    }});
                 ''')
+            else:
+                if command.name not in commands_with_blocking_operations:
+                    out.append(f'auto lock = intercept->{write_lock}();\n')
+                else:
+                    out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
+
+                # Because each intercept is a copy of ValidationObject, we need to update it for each
+                if command.errorCodes and 'VK_ERROR_DEVICE_LOST' in command.errorCodes:
+                    out.append('''
+                        if (result == VK_ERROR_DEVICE_LOST) {
+                            intercept->is_device_lost = true;
+                        }
+                    ''')
 
-            out.append(f'intercept->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
+                out.append(f'intercept->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
             out.append('    }\n')
             out.append('}\n')
 
@@ -149,11 +149,19 @@ class SyncValidationOutputGenerator(BaseGenerator):
             #pragma once
 
             #include <array>
-            #include <bitset>
             #include <map>
+            #include <stddef.h>
             #include <stdint.h>
             #include <vulkan/vulkan.h>
             #include "containers/custom_containers.h"
+
+            #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+            #include <emmintrin.h>
+            #define SYNC_STAGE_ACCESS_FLAGS_SSE2
+            #elif defined(__ARM_NEON) || defined(_M_ARM64)
+            #include <arm_neon.h>
+            #define SYNC_STAGE_ACCESS_FLAGS_NEON
+            #endif
             ''')
         out.append('// clang-format off\n')
 
@@ -181,14 +189,14 @@ static const VkAccessFlagBits2 VK_ACCESS_2_PRESENT_PRESENTED_BIT_SYNCVAL = 0x{(1
         out.append('\n')
 
         syncStageAccessFlagsSize = 192
-        out.append(f'using SyncStageAccessFlags = std::bitset<{syncStageAccessFlagsSize}>;\n')
-        out.append('// Unique bit for each stage/access combination\n')
-        for access in [x for x in self.stageAccessCombo if x['stage_access_bit'] is not None]:
-            out.append(f'static const SyncStageAccessFlags {access["stage_access_bit"]} = (SyncStageAccessFlags(1) << {access["stage_access"]});\n')
-
         if len(self.stageAccessCombo) > syncStageAccessFlagsSize:
             print("The bitset is too small, errors will occur, need to increase syncStageAccessFlagsSize\n")
             sys.exit(1)
+        out.append(self.generateSyncStageAccessFlags(syncStageAccessFlagsSize // 64))
+
+        out.append('// Unique bit for each stage/access combination\n')
+        for access in [x for x in self.stageAccessCombo if x['stage_access_bit'] is not None]:
+            out.append(f'static constexpr SyncStageAccessFlags {access["stage_access_bit"]} = SyncStageAccessFlags::Bit({access["stage_access"]});\n')
 
         out.append(f'''
 struct SyncStageAccessInfoType {{
@@ -205,14 +213,14 @@ const std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}>& syncSta
 ''')
 
         out.append('// Constants defining the mask of all read and write stage_access states\n')
-        out.append('static const SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
         read_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] == 'true']
         out.append('    ')
         out.append(' |\n    '.join(read_list))
         out.append('\n);')
         out.append('\n\n')
 
-        out.append('static const SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
         write_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] != 'true']
         out.append('    ')
         out.append(' |\n    '.join(write_list))
@@ -241,6 +249,144 @@ const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyLater
         out.append('// clang-format on\n')
         self.write("".join(out))
 
+    # Fixed size replacement for std::bitset, with the subset of its interface that sync validation uses.
+    def generateSyncStageAccessFlags(self, word_count):
+        return f'''// Bit per stage/access combination, interchangeable with std::bitset<{word_count * 64}> for the operations sync validation uses.
+// Constants are built at compile time, and the operations done for every access of every hazard check (merging scopes,
+// testing for an intersection) work on two 64-bit words at a time with SSE2/NEON.
+class SyncStageAccessFlags {{
+  public:
+    static constexpr size_t kWordCount = {word_count};
+
+    constexpr SyncStageAccessFlags() : words_{{}} {{}}
+    constexpr explicit SyncStageAccessFlags(uint64_t low_bits) : words_{{low_bits}} {{}}
+    static constexpr SyncStageAccessFlags Bit(size_t index) {{
+        SyncStageAccessFlags flags;
+        flags.words_[index / 64] = uint64_t(1) << (index % 64);
+        return flags;
+    }}
+
+    static constexpr size_t size() {{ return kWordCount * 64; }}
+    constexpr bool test(size_t index) const {{ return ((words_[index / 64] >> (index % 64)) & 1) != 0; }}
+    constexpr bool operator[](size_t index) const {{ return test(index); }}
+    SyncStageAccessFlags &reset() {{
+        *this = SyncStageAccessFlags();
+        return *this;
+    }}
+
+    bool any() const {{
+        size_t i = 0;
+#if defined(SYNC_STAGE_ACCESS_FLAGS_SSE2)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&words_[i]));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF) return true;
+        }}
+#elif defined(SYNC_STAGE_ACCESS_FLAGS_NEON)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            const uint64x2_t v = vld1q_u64(&words_[i]);
+            if ((vgetq_lane_u64(v, 0) | vgetq_lane_u64(v, 1)) != 0) return true;
+        }}
+#endif
+        for (; i < kWordCount; ++i) {{
+            if (words_[i] != 0) return true;
+        }}
+        return false;
+    }}
+    bool none() const {{ return !any(); }}
+
+    // Same as (*this & other).any(), without building the intersection
+    bool Intersects(const SyncStageAccessFlags &other) const {{
+        size_t i = 0;
+#if defined(SYNC_STAGE_ACCESS_FLAGS_SSE2)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            const __m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&words_[i])),
+                                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(&other.words_[i])));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF) return true;
+        }}
+#elif defined(SYNC_STAGE_ACCESS_FLAGS_NEON)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            const uint64x2_t v = vandq_u64(vld1q_u64(&words_[i]), vld1q_u64(&other.words_[i]));
+            if ((vgetq_lane_u64(v, 0) | vgetq_lane_u64(v, 1)) != 0) return true;
+        }}
+#endif
+        for (; i < kWordCount; ++i) {{
+            if ((words_[i] & other.words_[i]) != 0) return true;
+        }}
+        return false;
+    }}
+
+    SyncStageAccessFlags &operator|=(const SyncStageAccessFlags &other) {{
+        size_t i = 0;
+#if defined(SYNC_STAGE_ACCESS_FLAGS_SSE2)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            __m128i *dst = reinterpret_cast<__m128i *>(&words_[i]);
+            const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&other.words_[i]));
+            _mm_storeu_si128(dst, _mm_or_si128(_mm_loadu_si128(dst), src));
+        }}
+#elif defined(SYNC_STAGE_ACCESS_FLAGS_NEON)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            vst1q_u64(&words_[i], vorrq_u64(vld1q_u64(&words_[i]), vld1q_u64(&other.words_[i])));
+        }}
+#endif
+        for (; i < kWordCount; ++i) {{
+            words_[i] |= other.words_[i];
+        }}
+        return *this;
+    }}
+    SyncStageAccessFlags &operator&=(const SyncStageAccessFlags &other) {{
+        size_t i = 0;
+#if defined(SYNC_STAGE_ACCESS_FLAGS_SSE2)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            __m128i *dst = reinterpret_cast<__m128i *>(&words_[i]);
+            const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&other.words_[i]));
+            _mm_storeu_si128(dst, _mm_and_si128(_mm_loadu_si128(dst), src));
+        }}
+#elif defined(SYNC_STAGE_ACCESS_FLAGS_NEON)
+        for (; i + 2 <= kWordCount; i += 2) {{
+            vst1q_u64(&words_[i], vandq_u64(vld1q_u64(&words_[i]), vld1q_u64(&other.words_[i])));
+        }}
+#endif
+        for (; i < kWordCount; ++i) {{
+            words_[i] &= other.words_[i];
+        }}
+        return *this;
+    }}
+
+    friend constexpr SyncStageAccessFlags operator|(const SyncStageAccessFlags &a, const SyncStageAccessFlags &b) {{
+        SyncStageAccessFlags result;
+        for (size_t i = 0; i < kWordCount; ++i) {{
+            result.words_[i] = a.words_[i] | b.words_[i];
+        }}
+        return result;
+    }}
+    friend constexpr SyncStageAccessFlags operator&(const SyncStageAccessFlags &a, const SyncStageAccessFlags &b) {{
+        SyncStageAccessFlags result;
+        for (size_t i = 0; i < kWordCount; ++i) {{
+            result.words_[i] = a.words_[i] & b.words_[i];
+        }}
+        return result;
+    }}
+    friend constexpr SyncStageAccessFlags operator~(const SyncStageAccessFlags &a) {{
+        SyncStageAccessFlags result;
+        for (size_t i = 0; i < kWordCount; ++i) {{
+            result.words_[i] = ~a.words_[i];
+        }}
+        return result;
+    }}
+    friend constexpr bool operator==(const SyncStageAccessFlags &a, const SyncStageAccessFlags &b) {{
+        for (size_t i = 0; i < kWordCount; ++i) {{
+            if (a.words_[i] != b.words_[i]) return false;
+        }}
+        return true;
+    }}
+    friend constexpr bool operator!=(const SyncStageAccessFlags &a, const SyncStageAccessFlags &b) {{ return !(a == b); }}
+
+  private:
+    uint64_t words_[kWordCount];
+}};
+
+'''
+
     def generateSource(self):
         out = []
         out.append('''
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <gtest/gtest.h>
+
+// Helpers for the DISABLED_*Benchmark tests, which are intended to be used locally to compare implementations. Timings are
+// attached to the test as properties instead of printed, so they land in the report written by --gtest_output=xml:<file>
+namespace benchmark {
+
+template <typename Func>
+double TimeMs(Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+inline void RecordMs(const std::string &name, double ms) { ::testing::Test::RecordProperty(name, std::to_string(ms)); }
+
+// Keeps the result of a timed loop alive, so the compiler cannot drop the work being measured
+inline void KeepAlive(uint64_t value) {
+    volatile uint64_t sink = value;
+    (void)sink;
+}
+
+}  // namespace benchmark
@@ -183,6 +183,80 @@ TEST_F(NegativeGpuAV, SelectInstrumentedShaders) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeGpuAV, ParallelInstrumentation) {
+    TEST_DESCRIPTION("Instrument the shaders of multiple pipelines created in a single call on multiple threads");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_parallel_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+
+    VkPhysicalDeviceFeatures2 features2 = vku::InitStructHelper();
+    GetPhysicalDeviceFeatures2(features2);
+    if (!features2.features.robustBufferAccess) {
+        GTEST_SKIP() << "Not safe to write outside of buffer memory";
+    }
+    // Robust buffer access will be on by default
+    RETURN_IF_SKIP(InitState());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vkt::Buffer write_buffer(*m_device, 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, reqs);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+    static const char shader_a[] = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[4] = 0xdeadca71;
+        }
+    )glsl";
+    static const char shader_b[] = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[8] = Data.data[0] + 1;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe_a(*this);
+    pipe_a.cp_ci_.layout = pipeline_layout.handle();
+    pipe_a.cs_ = std::make_unique<VkShaderObj>(this, shader_a, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_a.LateBindPipelineInfo();
+    CreateComputePipelineHelper pipe_b(*this);
+    pipe_b.cp_ci_.layout = pipeline_layout.handle();
+    pipe_b.cs_ = std::make_unique<VkShaderObj>(this, shader_b, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_b.LateBindPipelineInfo();
+
+    const VkComputePipelineCreateInfo create_infos[2] = {pipe_a.cp_ci_, pipe_b.cp_ci_};
+    VkPipeline pipelines[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    ASSERT_EQ(VK_SUCCESS, vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 2, create_infos, nullptr, pipelines));
+
+    m_commandBuffer->begin();
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    for (VkPipeline pipeline : pipelines) {
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    }
+    m_commandBuffer->end();
+
+    // Both shaders were instrumented
+    m_errorMonitor->ExpectSuccess(kWarningBit | kErrorBit);
+    m_errorMonitor->SetDesiredWarning("VUID-vkCmdDispatch-storageBuffers-06936", 2);
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
 TEST_F(NegativeGpuAV, UseAllDescriptorSlotsPipelineNotReserved) {
     TEST_DESCRIPTION("Don't reserve a descriptor slot and proceed to use them all so GPU-AV can't");
     SetTargetApiVersion(VK_API_VERSION_1_2);
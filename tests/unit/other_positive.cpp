@@ -642,4 +642,42 @@ TEST_F(VkPositiveLayerTest, TimelineSemaphoreWithVulkan11) {
     AddRequiredExtensions(VK_NV_LOW_LATENCY_2_EXTENSION_NAME);
     AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
     RETURN_IF_SKIP(Init());
-}
\ No newline at end of file
+}
+TEST_F(VkPositiveLayerTest, ValidationCacheUnalignedData) {
+    TEST_DESCRIPTION("Round trip validation cache data through buffers that are not 4 byte aligned");
+    AddRequiredExtensions(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+
+    VkValidationCacheCreateInfoEXT cache_ci = vku::InitStructHelper();
+    VkValidationCacheEXT cache = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateValidationCacheEXT(device(), &cache_ci, nullptr, &cache));
+
+    // Validating a shader against the cache adds a record to it
+    const auto spv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, kMinimalShaderGlsl);
+    VkShaderModuleValidationCacheCreateInfoEXT module_cache_ci = vku::InitStructHelper();
+    module_cache_ci.validationCache = cache;
+    VkShaderModuleCreateInfo module_ci = vku::InitStructHelper(&module_cache_ci);
+    module_ci.codeSize = spv.size() * sizeof(uint32_t);
+    module_ci.pCode = spv.data();
+    vkt::ShaderModule module(*m_device, module_ci);
+
+    size_t data_size = 0;
+    vk::GetValidationCacheDataEXT(device(), cache, &data_size, nullptr);
+    std::vector<uint8_t> data(data_size + 1);
+    ASSERT_EQ(VK_SUCCESS, vk::GetValidationCacheDataEXT(device(), cache, &data_size, data.data() + 1));
+
+    cache_ci.initialDataSize = data_size;
+    cache_ci.pInitialData = data.data() + 1;
+    VkValidationCacheEXT loaded_cache = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateValidationCacheEXT(device(), &cache_ci, nullptr, &loaded_cache));
+
+    size_t loaded_size = 0;
+    vk::GetValidationCacheDataEXT(device(), loaded_cache, &loaded_size, nullptr);
+    ASSERT_EQ(data_size, loaded_size);
+    std::vector<uint8_t> loaded_data(loaded_size + 3);
+    ASSERT_EQ(VK_SUCCESS, vk::GetValidationCacheDataEXT(device(), loaded_cache, &loaded_size, loaded_data.data() + 3));
+    ASSERT_EQ(0, memcmp(data.data() + 1, loaded_data.data() + 3, data_size));
+
+    vk::DestroyValidationCacheEXT(device(), loaded_cache, nullptr);
+    vk::DestroyValidationCacheEXT(device(), cache, nullptr);
+}
@@ -11,6 +11,7 @@
  *     http://www.apache.org/licenses/LICENSE-2.0
  */
 
+#include <thread>
 #include "../framework/layer_validation_tests.h"
 #include "../framework/ray_tracing_objects.h"
 #include "../framework/shader_helper.h"
@@ -977,6 +978,78 @@ TEST_F(PositiveRayTracing, BasicTraceRaysDeferredBuild) {
     m_device->Wait();
 }
 
+TEST_F(PositiveRayTracing, DeferredPipelineJoinedOnOtherThread) {
+    TEST_DESCRIPTION(
+        "Create ray tracing pipelines with deferred operations completed on another thread, then write to their pipeline cache "
+        "from a third thread. The thread safety checks of the creations, sampled or not, must be over by then.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::rayTracingPipeline);
+    // Only some of the creations are tracked
+    const uint32_t sample_rate = 2;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_sample_rate", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &sample_rate};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    VkValidationFeaturesEXT validation_features = vku::InitStructHelper(&layer_settings_create_info);
+    RETURN_IF_SKIP(InitFrameworkForRayTracingTest(&validation_features));
+    RETURN_IF_SKIP(InitState());
+
+    const vkt::PipelineLayout pipeline_layout(*m_device, {});
+    VkShaderObj rgen_shader(this, kRayTracingMinimalGlsl, VK_SHADER_STAGE_RAYGEN_BIT_KHR, SPV_ENV_VULKAN_1_2);
+    VkPipelineShaderStageCreateInfo stage_create_info = vku::InitStructHelper();
+    stage_create_info.stage = VK_SHADER_STAGE_RAYGEN_BIT_KHR;
+    stage_create_info.module = rgen_shader.handle();
+    stage_create_info.pName = "main";
+    VkRayTracingShaderGroupCreateInfoKHR group_create_info = vku::InitStructHelper();
+    group_create_info.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_GENERAL_KHR;
+    group_create_info.generalShader = 0;
+    group_create_info.closestHitShader = VK_SHADER_UNUSED_KHR;
+    group_create_info.anyHitShader = VK_SHADER_UNUSED_KHR;
+    group_create_info.intersectionShader = VK_SHADER_UNUSED_KHR;
+    VkRayTracingPipelineCreateInfoKHR pipeline_ci = vku::InitStructHelper();
+    pipeline_ci.stageCount = 1;
+    pipeline_ci.pStages = &stage_create_info;
+    pipeline_ci.groupCount = 1;
+    pipeline_ci.pGroups = &group_create_info;
+    pipeline_ci.maxPipelineRayRecursionDepth = 1;
+    pipeline_ci.layout = pipeline_layout.handle();
+
+    const VkPipelineCacheCreateInfo cache_ci = vku::InitStructHelper();
+    const vkt::PipelineCache src_cache(*m_device, cache_ci);
+    const VkPipelineCache src_cache_handle = src_cache.handle();
+
+    // Enough creations for both tracked and untracked ones, the calls are sampled in windows of a few hundred calls
+    for (uint32_t i = 0; i < 256; ++i) {
+        vkt::PipelineCache cache(*m_device, cache_ci);
+        VkDeferredOperationKHR deferred_op = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_SUCCESS, vk::CreateDeferredOperationKHR(device(), nullptr, &deferred_op));
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        const VkResult create_result =
+            vk::CreateRayTracingPipelinesKHR(device(), deferred_op, cache.handle(), 1, &pipeline_ci, nullptr, &pipeline);
+        ASSERT_TRUE(create_result == VK_SUCCESS || create_result == VK_OPERATION_DEFERRED_KHR ||
+                    create_result == VK_OPERATION_NOT_DEFERRED_KHR);
+
+        std::thread joining_thread([&]() {
+            if (create_result == VK_OPERATION_DEFERRED_KHR) {
+                while (vk::DeferredOperationJoinKHR(device(), deferred_op) == VK_THREAD_IDLE_KHR) {
+                }
+            }
+            VkResult result = VK_NOT_READY;
+            while ((result = vk::GetDeferredOperationResultKHR(device(), deferred_op)) == VK_NOT_READY) {
+            }
+            EXPECT_EQ(VK_SUCCESS, result);
+        });
+        joining_thread.join();
+
+        std::thread writing_thread([&]() { vk::MergePipelineCaches(device(), cache.handle(), 1, &src_cache_handle); });
+        writing_thread.join();
+
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+        vk::DestroyDeferredOperationKHR(device(), deferred_op, nullptr);
+    }
+}
+
 TEST_F(PositiveRayTracing, GetAccelerationStructureAddressBadBuffer) {
     TEST_DESCRIPTION(
         "Call vkGetAccelerationStructureDeviceAddressKHR on an acceleration structure whose buffer is missing usage "
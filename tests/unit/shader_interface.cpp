@@ -1765,6 +1765,63 @@ TEST_F(NegativeShaderInterface, InvalidStaticSpirvMaintenance5Compute) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderInterface, InvalidStaticSpirvMaintenance5ParallelParsing) {
+    TEST_DESCRIPTION("Test SPIRV is still checked if the shader modules in VkPipelineShaderStageCreateInfo are parsed in parallel");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::maintenance5);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_shader_parsing", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Vertex %main "main"
+               OpSource GLSL 460
+               OpMemberDecorate %gl_PerVertex 2 BuiltIn Position
+               OpDecorate %gl_PerVertex Location 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+    std::vector<uint32_t> vert_shader;
+    ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, spv_source, vert_shader);
+    std::vector<uint32_t> frag_shader = GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, kFragmentMinimalGlsl);
+
+    VkShaderModuleCreateInfo module_create_infos[2];
+    module_create_infos[0] = vku::InitStructHelper();
+    module_create_infos[0].pCode = vert_shader.data();
+    module_create_infos[0].codeSize = vert_shader.size() * sizeof(uint32_t);
+    module_create_infos[1] = vku::InitStructHelper();
+    module_create_infos[1].pCode = frag_shader.data();
+    module_create_infos[1].codeSize = frag_shader.size() * sizeof(uint32_t);
+
+    VkPipelineShaderStageCreateInfo stage_cis[2];
+    stage_cis[0] = vku::InitStructHelper(&module_create_infos[0]);
+    stage_cis[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage_cis[0].module = VK_NULL_HANDLE;
+    stage_cis[0].pName = "main";
+    stage_cis[1] = vku::InitStructHelper(&module_create_infos[1]);
+    stage_cis[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stage_cis[1].module = VK_NULL_HANDLE;
+    stage_cis[1].pName = "main";
+
+    CreatePipelineHelper pipe(*this);
+    pipe.gp_ci_.stageCount = 2;
+    pipe.gp_ci_.pStages = stage_cis;
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
+    pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyFound();
+}
+
 // TODO - Disabled until https://github.com/KhronosGroup/glslang/issues/3505
 // is resolved in the WG.
 TEST_F(NegativeShaderInterface, DISABLED_PhysicalStorageBufferGlslang3) {
@@ -16,7 +16,10 @@
 #include "../framework/render_pass_helper.h"
 #include "../framework/descriptor_helper.h"
 #include "../framework/queue_submit_context.h"
+#include "../framework/thread_helper.h"
+#include "../layers/sync/sync_settings.h"
 #include <utils/vk_layer_utils.h>
+#include <thread>
 
 class NegativeSyncVal : public VkSyncValTest {};
 
@@ -6560,3 +6563,93 @@ TEST_F(NegativeSyncVal, ResourceHandleIndexStability) {
 
     m_default_queue->Wait();
 }
+
+TEST_F(NegativeSyncVal, UnlockedRecordingFromMultipleThreads) {
+    TEST_DESCRIPTION("Recording time hazards are found when command buffers are recorded on multiple threads without the lock");
+    SyncValSettings settings;
+    settings.unlocked_recording = true;
+    RETURN_IF_SKIP(InitSyncValFramework(&settings));
+    RETURN_IF_SKIP(InitState());
+
+    constexpr uint32_t thread_count = 8;
+    constexpr uint32_t iteration_count = 100;
+    constexpr VkDeviceSize size = 256;
+    // All threads use the same buffers, in their own command buffers
+    const vkt::Buffer src(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    const vkt::Buffer dst(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    VkBufferCopy region = {};
+    region.size = size;
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    // Every other iteration misses the barrier between the copies, which is exactly one hazard each
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE", thread_count * iteration_count / 2);
+    ThreadTimeoutHelper timeout_helper(thread_count);
+    auto recording_thread = [&]() {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        vkt::CommandPool pool(*m_device, m_device->graphics_queue_node_index_);
+        vkt::CommandBuffer cb(*m_device, pool);
+        for (uint32_t i = 0; i < iteration_count; i++) {
+            cb.begin();
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+            if (i % 2 == 0) {
+                vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                                       nullptr, 0, nullptr);
+            }
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+            cb.end();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads.emplace_back(recording_thread);
+    }
+
+    constexpr int wait_time = 100;
+    if (!timeout_helper.WaitForThreads(wait_time)) {
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit: " << wait_time << " seconds.";
+        return;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeSyncVal, ParallelHazardDetection) {
+    TEST_DESCRIPTION("Submit time hazards are found when the checks are split over multiple threads");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.parallel_hazard_detection = true;
+    RETURN_IF_SKIP(InitSyncValFramework(&settings));
+    RETURN_IF_SKIP(InitState());
+
+    // Enough separate regions for the checks to be split between threads
+    constexpr uint32_t region_count = 256;
+    const VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, region_count * 128, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, region_count * 128, transfer_usage);
+    std::vector<VkBufferCopy> regions;
+    for (uint32_t i = 0; i < region_count; ++i) {
+        regions.push_back({i * 128, i * 128, 64});
+    }
+
+    // Only the last region is written by both command buffers
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    cb0.begin();
+    vk::CmdCopyBuffer(cb0, buffer_a, buffer_b, 1, &regions.back());
+    cb0.end();
+
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+    cb1.begin();
+    vk::CmdCopyBuffer(cb1, buffer_a, buffer_b, region_count, regions.data());
+    cb1.end();
+
+    m_default_queue->Submit(cb0);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    m_default_queue->Submit(cb1);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
@@ -51,6 +51,14 @@ void VkSyncValTest::InitSyncValFramework(const SyncValSettings *p_sync_settings)
     settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_shader_accesses_heuristic",
                                             VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &shader_accesses_heuristic});
 
+    const auto parallel_hazard_detection = static_cast<VkBool32>(sync_settings.parallel_hazard_detection);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_parallel_hazard_detection",
+                                            VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &parallel_hazard_detection});
+
+    const auto unlocked_recording = static_cast<VkBool32>(sync_settings.unlocked_recording);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_unlocked_recording", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                            &unlocked_recording});
+
     VkLayerSettingsCreateInfoEXT settings_create_info = vku::InitStructHelper();
     settings_create_info.settingCount = size32(settings);
     settings_create_info.pSettings = settings.data();
@@ -393,6 +401,58 @@ TEST_F(PositiveSyncVal, GetSemaphoreCounterFromMultipleThreads) {
     signaling_thread.join();
 }
 
+TEST_F(PositiveSyncVal, RecordCommandBuffersFromMultipleThreads) {
+    TEST_DESCRIPTION("Record command buffers from multiple threads, each thread using its own pool and resources");
+    SyncValSettings settings;
+    settings.unlocked_recording = true;
+    RETURN_IF_SKIP(InitSyncValFramework(&settings));
+    RETURN_IF_SKIP(InitState());
+
+    constexpr int thread_count = 8;
+    constexpr int iteration_count = 200;
+    constexpr VkDeviceSize size = 256;
+
+    std::atomic<bool> bailout{false};
+    m_errorMonitor->SetBailout(&bailout);
+    ThreadTimeoutHelper timeout_helper(thread_count);
+
+    auto recording_thread = [&]() {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        vkt::CommandPool pool(*m_device, m_device->graphics_queue_node_index_);
+        vkt::CommandBuffer cb(*m_device, pool);
+        const vkt::Buffer src(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+        const vkt::Buffer dst(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        VkBufferCopy region = {};
+        region.size = size;
+
+        VkMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        for (int i = 0; i < iteration_count && !bailout.load(); i++) {
+            cb.begin();
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+            vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                                   nullptr, 0, nullptr);
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+            cb.end();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back(recording_thread);
+    }
+
+    constexpr int wait_time = 100;
+    if (!timeout_helper.WaitForThreads(wait_time)) {
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit: " << wait_time << " seconds.";
+        return;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
 TEST_F(PositiveSyncVal, ShaderReferencesNotBoundSet) {
     TEST_DESCRIPTION("Shader references a descriptor set that was not bound. SyncVal should not crash if core checks are disabled");
     RETURN_IF_SKIP(InitSyncValFramework());
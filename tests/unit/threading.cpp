@@ -74,6 +74,43 @@ TEST_F(NegativeThreading, CommandBufferCollision) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeThreading, CommandBufferCollisionSampled) {
+    TEST_DESCRIPTION("Collisions are still found when only some of the calls are checked");
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");
+
+    const uint32_t sample_rate = 8;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_sample_rate", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &sample_rate};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    commandBuffer.begin();
+    vkt::Event event(*m_device);
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    commandBuffer.end();
+
+    m_errorMonitor->SetBailout(NULL);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeThreading, UpdateDescriptorCollision) {
     TEST_DESCRIPTION("Two threads updating the same descriptor set, expected to generate a threading error");
 
@@ -12,6 +12,7 @@
  *     http://www.apache.org/licenses/LICENSE-2.0
  */
 
+#include <limits>
 #include <thread>
 #include "../framework/layer_validation_tests.h"
 #include "../framework/descriptor_helper.h"
@@ -137,6 +138,83 @@ TEST_F(PositiveThreading, NullFenceCollision) {
     m_errorMonitor->SetBailout(NULL);
 }
 
+TEST_F(PositiveThreading, CommandBufferCollisionNotSampled) {
+    TEST_DESCRIPTION("Collisions in calls that are not sampled for thread safety checks are not found");
+
+    // Only the first window of calls made with sampling on is checked, all the following ones are skipped
+    const uint32_t sample_rate = std::numeric_limits<uint32_t>::max();
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_sample_rate", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &sample_rate};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    if (!IsPlatformMockICD()) {
+        // The collision is really not checked, so a driver would see the command buffer recorded from two threads at once
+        GTEST_SKIP() << "This test only runs on MockICD";
+    }
+
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    commandBuffer.begin();
+    vkt::Event event(*m_device);
+
+    // Make sure the first window, if it is the current one, is over before the threads start
+    for (int i = 0; i < 1024; i++) {
+        vk::CmdSetEvent(commandBuffer.handle(), event.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    }
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    commandBuffer.end();
+}
+
+TEST_F(PositiveThreading, SharedEventSampled) {
+    TEST_DESCRIPTION("Every read tracked while sampling is ended, so reads of a shared object are never seen as a collision");
+
+    const uint32_t sample_rate = 2;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_sample_rate", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &sample_rate};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Event event(*m_device);
+    std::atomic<bool> bailout{false};
+
+    // Each thread records its own command buffer, the event is only read, across many sampled and skipped windows
+    vkt::CommandPool thread_pool(*m_device, m_device->graphics_queue_node_index_);
+    vkt::CommandBuffer thread_command_buffer(*m_device, thread_pool);
+    thread_command_buffer.begin();
+    m_commandBuffer->begin();
+
+    ThreadTestData thread_data;
+    thread_data.commandBuffer = thread_command_buffer.handle();
+    thread_data.event = event.handle();
+    thread_data.bailout = &bailout;
+    ThreadTestData data;
+    data.commandBuffer = m_commandBuffer->handle();
+    data.event = event.handle();
+    data.bailout = &bailout;
+
+    m_errorMonitor->SetBailout(&bailout);
+    std::thread thread(AddToCommandBuffer, &thread_data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    m_errorMonitor->SetBailout(nullptr);
+
+    m_commandBuffer->end();
+    thread_command_buffer.end();
+}
+
 TEST_F(PositiveThreading, DebugObjectNames) {
     AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
     RETURN_IF_SKIP(Init());
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "utils/arena.h"
+
+TEST(CustomContainer, ArenaReuseAfterReset) {
+    vvl::Arena arena(1024);
+    void *first = arena.Allocate(100, 8);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(first) % 8, 0u);
+    void *second = arena.Allocate(3, 1);
+    void *third = arena.Allocate(16, 16);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third) % 16, 0u);
+    ASSERT_NE(first, second);
+    ASSERT_NE(second, third);
+
+    // Bigger than a block, and then enough to start a new block
+    arena.Allocate(4096, 8);
+    arena.Allocate(1000, 8);
+    const size_t capacity = arena.Capacity();
+    ASSERT_GE(capacity, 1024u + 4096u);
+
+    // The same allocations after a reset take no more memory
+    arena.Reset();
+    ASSERT_EQ(arena.Allocate(100, 8), first);
+    arena.Allocate(3, 1);
+    arena.Allocate(16, 16);
+    arena.Allocate(4096, 8);
+    arena.Allocate(1000, 8);
+    ASSERT_EQ(arena.Capacity(), capacity);
+}
+
+TEST(CustomContainer, ArenaReuseFreed) {
+    vvl::Arena arena(1024);
+    void *first = arena.Allocate(40, 8);
+    arena.Free(first, 40);
+    // Same size class
+    ASSERT_EQ(arena.Allocate(48, 8), first);
+
+    // Bigger allocations are only reclaimed by Reset()
+    void *big = arena.Allocate(vvl::Arena::kMaxReusedSize + 1, 8);
+    arena.Free(big, vvl::Arena::kMaxReusedSize + 1);
+    ASSERT_NE(arena.Allocate(vvl::Arena::kMaxReusedSize + 1, 8), big);
+
+    // A map updated in place stops growing the arena
+    using Allocator = vvl::ArenaAllocator<std::pair<const uint32_t, uint64_t>>;
+    using Map = std::map<uint32_t, uint64_t, std::less<uint32_t>, Allocator>;
+    auto map_arena = std::make_shared<vvl::Arena>();
+    Map map{Allocator(map_arena)};
+    for (uint32_t i = 0; i < 1000; ++i) {
+        map.emplace(i, i);
+    }
+    const size_t capacity = map_arena->Capacity();
+    for (uint32_t round = 0; round < 100; ++round) {
+        for (uint32_t i = 0; i < 1000; i += 2) {
+            map.erase(i);
+        }
+        for (uint32_t i = 0; i < 1000; i += 2) {
+            map.emplace(i, i + round);
+        }
+    }
+    ASSERT_EQ(map_arena->Capacity(), capacity);
+}
+
+TEST(CustomContainer, ArenaFreeFromOtherThreads) {
+    constexpr uint32_t kThreadCount = 4;
+    constexpr uint32_t kChunksPerThread = 1000;
+    vvl::Arena arena;
+    std::vector<std::vector<void *>> chunks(kThreadCount);
+    for (auto &thread_chunks : chunks) {
+        for (uint32_t i = 0; i < kChunksPerThread; ++i) {
+            thread_chunks.push_back(arena.Allocate(64, 8));
+        }
+    }
+
+    // The last references to objects in the arena can be dropped anywhere, while the owner keeps allocating
+    std::vector<std::thread> threads;
+    for (auto &thread_chunks : chunks) {
+        threads.emplace_back([&arena, &thread_chunks]() {
+            for (void *chunk : thread_chunks) {
+                arena.Free(chunk, 64);
+            }
+        });
+    }
+    std::set<void *> allocated;
+    for (uint32_t i = 0; i < kThreadCount * kChunksPerThread; ++i) {
+        void *chunk = arena.Allocate(64, 8);
+        // Written to, so a chunk handed out while another thread still frees it shows up as a race
+        static_cast<uint64_t *>(chunk)[7] = i;
+        ASSERT_TRUE(allocated.insert(chunk).second);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t i = 0; i < kThreadCount * kChunksPerThread; ++i) {
+        ASSERT_TRUE(allocated.insert(arena.Allocate(64, 8)).second);
+    }
+
+    // Everything freed was handed out again exactly once, before the arena took new memory
+    size_t reused = 0;
+    for (const auto &thread_chunks : chunks) {
+        for (void *chunk : thread_chunks) {
+            reused += allocated.count(chunk);
+        }
+    }
+    ASSERT_EQ(reused, kThreadCount * kChunksPerThread);
+}
+
+TEST(CustomContainer, ArenaAllocatorContainers) {
+    using Allocator = vvl::ArenaAllocator<std::pair<const uint32_t, uint64_t>>;
+    using Map = std::map<uint32_t, uint64_t, std::less<uint32_t>, Allocator>;
+
+    auto arena = std::make_shared<vvl::Arena>();
+    Map map{Allocator(arena)};
+    for (uint32_t i = 0; i < 1000; ++i) {
+        map.emplace(i, uint64_t(i) * 3);
+    }
+    ASSERT_GT(arena->Capacity(), 0u);
+
+    // Copies don't allocate from the arena, nor keep it alive
+    Map copy(map);
+    ASSERT_EQ(copy.get_allocator().GetArena(), nullptr);
+    ASSERT_EQ(copy.size(), map.size());
+    // Unless given the allocator
+    {
+        const size_t capacity = arena->Capacity();
+        Map arena_copy(map, map.get_allocator());
+        ASSERT_EQ(arena_copy.get_allocator().GetArena(), arena);
+        ASSERT_GT(arena->Capacity(), capacity);
+    }
+
+    // The map keeps the arena alive
+    std::weak_ptr<vvl::Arena> weak_arena = arena;
+    arena.reset();
+    map.erase(500);
+    ASSERT_FALSE(weak_arena.expired());
+    map = Map();
+    ASSERT_TRUE(weak_arena.expired());
+    ASSERT_EQ(copy.at(500), 1500u);
+
+    // Shared objects can live in the arena too
+    arena = std::make_shared<vvl::Arena>();
+    auto shared = std::allocate_shared<uint64_t>(vvl::ArenaAllocator<uint64_t>(arena), 42u);
+    ASSERT_EQ(*shared, 42u);
+    ASSERT_GT(arena.use_count(), 1);
+    shared.reset();
+    ASSERT_EQ(arena.use_count(), 1);
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "utils/cache_records.h"
+#include "utils/mapped_file.h"
+#include "utils/spirv_cache_file.h"
+
+// A file in the temp directory, removed when the test is done
+class TempCacheFile {
+  public:
+    TempCacheFile(const char *name) {
+        path_ = (std::filesystem::temp_directory_path() / name).string();
+        std::filesystem::remove(path_);
+    }
+    ~TempCacheFile() { std::filesystem::remove(path_); }
+
+    const char *Path() const { return path_.c_str(); }
+
+    void Write(const std::vector<uint32_t> &words, size_t size_in_bytes) const {
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(words.data()), static_cast<std::streamsize>(size_in_bytes));
+    }
+
+    std::vector<uint32_t> Read() const {
+        auto mapped_file = vvl::MappedFile::Open(path_.c_str());
+        if (!mapped_file) return {};
+        std::vector<uint32_t> words(mapped_file->Size() / sizeof(uint32_t));
+        std::memcpy(words.data(), mapped_file->Data(), words.size() * sizeof(uint32_t));
+        return words;
+    }
+
+  private:
+    std::string path_;
+};
+
+// Reads all the intact records, returns true if they end exactly at the end of words
+static bool ReadRecords(const std::vector<uint32_t> &words, size_t first_word, std::vector<uint32_t> &out_keys) {
+    size_t pos = first_word;
+    vvl::CacheRecord record;
+    while (vvl::ReadCacheRecord(words.data(), words.size(), pos, record)) {
+        out_keys.push_back(record.payload[0]);
+    }
+    return pos == words.size();
+}
+
+static std::vector<uint32_t> MakeRecords(uint32_t first_key, uint32_t count) {
+    std::vector<uint32_t> words(count * vvl::CacheRecordWords(3));
+    uint32_t *out = words.data();
+    for (uint32_t key = first_key; key < first_key + count; key++) {
+        const uint32_t data[] = {key * 2, key * 3};
+        out = vvl::WriteCacheRecord(out, 7, key, data, 2);
+    }
+    return words;
+}
+
+TEST(CacheFile, MappedFile) {
+    TempCacheFile file("vvl_test_mapped_file.bin");
+    ASSERT_EQ(vvl::MappedFile::Open(file.Path()), nullptr);
+
+    // An empty file can't be mapped
+    file.Write({}, 0);
+    ASSERT_EQ(vvl::MappedFile::Open(file.Path()), nullptr);
+
+    const std::vector<uint32_t> words = {1, 2, 3, 4, 5};
+    file.Write(words, 18);
+    auto mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_NE(mapped_file, nullptr);
+    ASSERT_EQ(mapped_file->Size(), 18u);
+    ASSERT_EQ(std::memcmp(mapped_file->Data(), words.data(), 18), 0);
+
+    // Some platforms can't replace a file that is mapped
+    mapped_file.reset();
+    const std::vector<uint32_t> other_words = {9, 9};
+    ASSERT_TRUE(vvl::WriteFileAtomic(file.Path(), other_words.data(), other_words.size() * sizeof(uint32_t)));
+    ASSERT_EQ(file.Read(), other_words);
+}
+
+TEST(CacheFile, AppendToFile) {
+    TempCacheFile file("vvl_test_append_to_file.bin");
+    const std::vector<uint32_t> header = {0x1234, 0x5678};
+    const std::vector<uint32_t> data = {1, 2, 3};
+
+    // Nothing to append to
+    ASSERT_FALSE(vvl::AppendToFile(file.Path(), header.data(), header.size() * sizeof(uint32_t), data.data(), 12));
+
+    ASSERT_TRUE(vvl::WriteFileAtomic(file.Path(), header.data(), header.size() * sizeof(uint32_t)));
+    ASSERT_TRUE(vvl::AppendToFile(file.Path(), header.data(), header.size() * sizeof(uint32_t), data.data(), 12));
+    ASSERT_TRUE(vvl::AppendToFile(file.Path(), header.data(), header.size() * sizeof(uint32_t), data.data(), 12));
+    ASSERT_EQ(file.Read(), std::vector<uint32_t>({0x1234, 0x5678, 1, 2, 3, 1, 2, 3}));
+
+    // The file was replaced by a different kind of file, it is left alone
+    const std::vector<uint32_t> other_header = {0x1234, 0x9999};
+    ASSERT_FALSE(vvl::AppendToFile(file.Path(), other_header.data(), other_header.size() * sizeof(uint32_t), data.data(), 12));
+    ASSERT_EQ(file.Read().size(), 8u);
+}
+
+TEST(CacheFile, WriteFileAtomic) {
+    TempCacheFile file("vvl_test_write_file_atomic.bin");
+    const std::vector<uint32_t> first = {1, 2, 3, 4};
+    const std::vector<uint32_t> second = {5, 6};
+    ASSERT_TRUE(vvl::WriteFileAtomic(file.Path(), first.data(), first.size() * sizeof(uint32_t)));
+    ASSERT_EQ(file.Read(), first);
+    // Replaces the whole file, even if the new content is shorter
+    ASSERT_TRUE(vvl::WriteFileAtomic(file.Path(), second.data(), second.size() * sizeof(uint32_t)));
+    ASSERT_EQ(file.Read(), second);
+}
+
+TEST(CacheFile, RecordsIntact) {
+    const std::vector<uint32_t> words = MakeRecords(10, 4);
+    std::vector<uint32_t> keys;
+    ASSERT_TRUE(ReadRecords(words, 0, keys));
+    ASSERT_EQ(keys, std::vector<uint32_t>({10, 11, 12, 13}));
+
+    size_t pos = 0;
+    vvl::CacheRecord record;
+    ASSERT_TRUE(vvl::ReadCacheRecord(words.data(), words.size(), pos, record));
+    ASSERT_EQ(record.type, 7u);
+    ASSERT_EQ(record.payload_size, 3u);
+    ASSERT_EQ(record.payload[1], 20u);
+    ASSERT_EQ(record.payload[2], 30u);
+    ASSERT_EQ(pos, vvl::CacheRecordWords(3));
+}
+
+TEST(CacheFile, RecordsTruncatedTail) {
+    std::vector<uint32_t> words = MakeRecords(10, 4);
+    // The last record is cut short at every possible word
+    for (size_t cut = 1; cut < vvl::CacheRecordWords(3); cut++) {
+        std::vector<uint32_t> truncated(words.begin(), words.end() - cut);
+        std::vector<uint32_t> keys;
+        ASSERT_FALSE(ReadRecords(truncated, 0, keys));
+        ASSERT_EQ(keys, std::vector<uint32_t>({10, 11, 12}));
+    }
+}
+
+TEST(CacheFile, RecordsTornMidWord) {
+    TempCacheFile file("vvl_test_records_torn.bin");
+    std::vector<uint32_t> words = MakeRecords(10, 2);
+    const size_t full_size = words.size() * sizeof(uint32_t);
+
+    // A write that stopped in the middle of the last word leaves a file that isn't a whole number of words
+    file.Write(words, full_size - 2);
+    auto mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_NE(mapped_file, nullptr);
+    ASSERT_NE(mapped_file->Size() % sizeof(uint32_t), 0u);
+    std::vector<uint32_t> keys;
+    ASSERT_FALSE(ReadRecords(file.Read(), 0, keys));
+    ASSERT_EQ(keys, std::vector<uint32_t>({10}));
+
+    // Space that was allocated for the record but never written reads as zeros, which the checksum rejects
+    std::memset(words.data() + vvl::CacheRecordWords(3) + 4, 0, sizeof(uint32_t) + 2);
+    keys.clear();
+    ASSERT_FALSE(ReadRecords(words, 0, keys));
+    ASSERT_EQ(keys, std::vector<uint32_t>({10}));
+}
+
+TEST(CacheFile, AppendAfterCorruption) {
+    TempCacheFile file("vvl_test_append_after_corruption.bin");
+    const std::vector<uint32_t> header = {0x1234, 0x5678};
+    std::vector<uint32_t> words = header;
+    const std::vector<uint32_t> records = MakeRecords(10, 2);
+    words.insert(words.end(), records.begin(), records.end() - 2);
+    file.Write(words, words.size() * sizeof(uint32_t));
+
+    // A later append lands after the torn record, where it can't be found
+    const std::vector<uint32_t> appended = MakeRecords(20, 1);
+    ASSERT_TRUE(vvl::AppendToFile(file.Path(), header.data(), header.size() * sizeof(uint32_t), appended.data(),
+                                  appended.size() * sizeof(uint32_t)));
+    std::vector<uint32_t> keys;
+    ASSERT_FALSE(ReadRecords(file.Read(), header.size(), keys));
+    ASSERT_EQ(keys, std::vector<uint32_t>({10}));
+
+    // So a damaged file is rewritten with the intact records instead of being appended to
+    words = header;
+    words.insert(words.end(), records.begin(), records.begin() + vvl::CacheRecordWords(3));
+    words.insert(words.end(), appended.begin(), appended.end());
+    ASSERT_TRUE(vvl::WriteFileAtomic(file.Path(), words.data(), words.size() * sizeof(uint32_t)));
+    keys.clear();
+    ASSERT_TRUE(ReadRecords(file.Read(), header.size(), keys));
+    ASSERT_EQ(keys, std::vector<uint32_t>({10, 20}));
+}
+
+// Writes a SPIR-V cache file with a shader of 4 dwords for each hash, and returns its content
+static std::vector<uint32_t> WriteSpirvCacheFile(const TempCacheFile &file, const char *key, const std::vector<uint32_t> &hashes) {
+    std::vector<std::vector<uint32_t>> spirv;
+    std::vector<std::pair<uint32_t, vvl::span<const uint32_t>>> shaders;
+    for (const uint32_t hash : hashes) {
+        spirv.push_back({0x07230203, hash, hash + 1, hash + 2});
+    }
+    for (size_t i = 0; i < hashes.size(); i++) {
+        shaders.emplace_back(hashes[i], vvl::span<const uint32_t>(spirv[i].data(), spirv[i].size()));
+    }
+    std::vector<uint32_t> words;
+    vvl::SpirvCacheFileView::Write(key, std::strlen(key), shaders, words);
+    file.Write(words, words.size() * sizeof(uint32_t));
+    return words;
+}
+
+TEST(CacheFile, SpirvCacheFileView) {
+    TempCacheFile file("vvl_test_spirv_cache_file.bin");
+    const char *key = "key12";  // padded to 8 bytes
+    WriteSpirvCacheFile(file, key, {3, 5, 9});
+    auto mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_NE(mapped_file, nullptr);
+
+    vvl::SpirvCacheFileView view;
+    ASSERT_TRUE(view.Parse(*mapped_file, key, std::strlen(key)));
+    ASSERT_EQ(view.Entries().size(), 3u);
+    const vvl::span<const uint32_t> spirv = view.Find(5);
+    ASSERT_EQ(spirv.size(), 4u);
+    ASSERT_EQ(spirv[1], 5u);
+    ASSERT_TRUE(view.Find(4).empty());
+    ASSERT_TRUE(view.Find(10).empty());
+
+    // Written for different settings
+    ASSERT_FALSE(view.Parse(*mapped_file, "key13", 5));
+    ASSERT_TRUE(view.Entries().empty());
+    ASSERT_TRUE(view.Find(5).empty());
+}
+
+TEST(CacheFile, SpirvCacheFileViewBadMagic) {
+    TempCacheFile file("vvl_test_spirv_cache_file_magic.bin");
+    const char *key = "key12";
+    std::vector<uint32_t> words = WriteSpirvCacheFile(file, key, {3, 5, 9});
+    words[2] ^= 1;  // magic right after the padded key
+    file.Write(words, words.size() * sizeof(uint32_t));
+    auto mapped_file = vvl::MappedFile::Open(file.Path());
+    vvl::SpirvCacheFileView view;
+    ASSERT_FALSE(view.Parse(*mapped_file, key, std::strlen(key)));
+    ASSERT_TRUE(view.Find(5).empty());
+
+    // Too short for the header
+    file.Write(words, 10);
+    mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_FALSE(view.Parse(*mapped_file, key, std::strlen(key)));
+}
+
+TEST(CacheFile, SpirvCacheFileViewBounds) {
+    TempCacheFile file("vvl_test_spirv_cache_file_bounds.bin");
+    const char *key = "key12";
+    const std::vector<uint32_t> words = WriteSpirvCacheFile(file, key, {3, 5, 9});
+    const size_t header_dwords = 4;
+    const size_t entries_dwords = 3 * sizeof(vvl::SpirvCacheFileView::Entry) / sizeof(uint32_t);
+
+    // An entry count larger than what the file holds
+    std::vector<uint32_t> corrupted = words;
+    corrupted[3] = 0x10000000;
+    file.Write(corrupted, corrupted.size() * sizeof(uint32_t));
+    auto mapped_file = vvl::MappedFile::Open(file.Path());
+    vvl::SpirvCacheFileView view;
+    ASSERT_FALSE(view.Parse(*mapped_file, key, std::strlen(key)));
+
+    // The file is cut in the middle of the last shader, the ones before it are still found
+    file.Write(words, (words.size() - 2) * sizeof(uint32_t));
+    mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_TRUE(view.Parse(*mapped_file, key, std::strlen(key)));
+    ASSERT_EQ(view.Find(3).size(), 4u);
+    ASSERT_EQ(view.Find(5).size(), 4u);
+    ASSERT_TRUE(view.Find(9).empty());
+
+    // Entries pointing past the end of the file, including ones where offset + dword_count overflows
+    corrupted = words;
+    corrupted[header_dwords + 1] = 12;       // offset of hash 3, right at the end
+    corrupted[header_dwords + 3 + 1] = 1;    // offset of hash 5
+    corrupted[header_dwords + 3 + 2] = 12;   // dword_count of hash 5, one past the end
+    corrupted[header_dwords + 6 + 2] = ~0u;  // dword_count of hash 9
+    ASSERT_EQ(corrupted.size(), header_dwords + entries_dwords + 12);
+    file.Write(corrupted, corrupted.size() * sizeof(uint32_t));
+    mapped_file = vvl::MappedFile::Open(file.Path());
+    ASSERT_TRUE(view.Parse(*mapped_file, key, std::strlen(key)));
+    ASSERT_TRUE(view.Find(3).empty());
+    ASSERT_TRUE(view.Find(5).empty());
+    ASSERT_TRUE(view.Find(9).empty());
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "utils/epoch_reclaimer.h"
+
+namespace {
+
+struct Counted {
+    explicit Counted(std::atomic<int> &live_) : live(live_), value(1) { ++live; }
+    ~Counted() {
+        value = 0;
+        --live;
+    }
+    std::atomic<int> &live;
+    int value;
+};
+
+}  // namespace
+
+TEST(CustomContainer, EpochReclaimerWaitsForCriticalSection) {
+    std::atomic<int> live{0};
+    vvl::EpochReclaimer reclaimer;
+    vvl::EpochReclaimer::Slot *slot = reclaimer.AcquireSlot();
+
+    Counted *before = new Counted(live);
+    reclaimer.Retire(before);
+    reclaimer.Enter(slot);
+    // Retired before the section started, so it can't be in use
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 0);
+
+    Counted *during = new Counted(live);
+    reclaimer.Retire(during);
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 1);
+    ASSERT_EQ(reclaimer.RetiredCount(), 1u);
+
+    reclaimer.Leave(slot);
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 0);
+    ASSERT_EQ(reclaimer.RetiredCount(), 0u);
+    reclaimer.ReleaseSlot(slot);
+}
+
+TEST(CustomContainer, EpochReclaimerReleasedSlot) {
+    std::atomic<int> live{0};
+    vvl::EpochReclaimer reclaimer;
+    vvl::EpochReclaimer::Slot *slot = reclaimer.AcquireSlot();
+    reclaimer.Enter(slot);
+    reclaimer.Retire(new Counted(live));
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 1);
+
+    // A released slot no longer holds back reclamation, and is reused by the next thread
+    reclaimer.ReleaseSlot(slot);
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 0);
+    ASSERT_EQ(reclaimer.AcquireSlot(), slot);
+    reclaimer.ReleaseSlot(slot);
+}
+
+TEST(CustomContainer, EpochReclaimerHandOver) {
+    // The creating thread leaves its section when handing a use over, which the finishing thread looks up again in its own
+    // section, as is done for deferred operations
+    std::atomic<int> live{0};
+    vvl::EpochReclaimer reclaimer;
+    std::atomic<Counted *> shared{new Counted(live)};
+
+    vvl::EpochReclaimer::Slot *slot = reclaimer.AcquireSlot();
+    reclaimer.Enter(slot);
+    ASSERT_EQ(shared.load()->value, 1);
+    reclaimer.Leave(slot);
+
+    std::thread finisher([&]() {
+        vvl::EpochReclaimer::Slot *finisher_slot = reclaimer.AcquireSlot();
+        reclaimer.Enter(finisher_slot);
+        EXPECT_EQ(shared.load()->value, 1);
+        reclaimer.Leave(finisher_slot);
+        reclaimer.ReleaseSlot(finisher_slot);
+    });
+    finisher.join();
+
+    // Destroying the object once the use is finished reclaims it, the creating thread isn't pinning an old epoch
+    reclaimer.Retire(shared.exchange(nullptr));
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 0);
+    reclaimer.ReleaseSlot(slot);
+}
+
+TEST(CustomContainer, EpochReclaimerFreesOnDestruction) {
+    std::atomic<int> live{0};
+    {
+        vvl::EpochReclaimer reclaimer;
+        vvl::EpochReclaimer::Slot *slot = reclaimer.AcquireSlot();
+        reclaimer.Enter(slot);
+        for (int i = 0; i < 10; ++i) {
+            reclaimer.Retire(new Counted(live));
+        }
+        reclaimer.Leave(slot);
+        reclaimer.ReleaseSlot(slot);
+        ASSERT_EQ(live.load(), 10);
+    }
+    ASSERT_EQ(live.load(), 0);
+}
+
+TEST(CustomContainer, EpochReclaimerThreads) {
+    std::atomic<int> live{0};
+    vvl::EpochReclaimer reclaimer;
+    std::atomic<Counted *> shared{new Counted(live)};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            vvl::EpochReclaimer::Slot *slot = reclaimer.AcquireSlot();
+            while (!done.load()) {
+                reclaimer.Enter(slot);
+                // Freed data would read 0 (or be caught by the address sanitizer)
+                EXPECT_EQ(shared.load()->value, 1);
+                reclaimer.Leave(slot);
+            }
+            reclaimer.ReleaseSlot(slot);
+        });
+    }
+    for (int i = 0; i < 10000; ++i) {
+        reclaimer.Retire(shared.exchange(new Counted(live)));
+    }
+    done.store(true);
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    // Retiring reclaims as it goes, all but the current object are freed once the readers are gone
+    reclaimer.Reclaim();
+    ASSERT_EQ(live.load(), 1);
+    delete shared.load();
+}
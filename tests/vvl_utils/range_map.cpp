@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "../framework/benchmark_helper.h"
+#include <cstdint>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "containers/range_vector.h"
+
+using TestRange = sparse_container::range<uint64_t>;
+using TestRangeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatTestRangeMap = sparse_container::flat_range_map<uint64_t, uint32_t>;
+using SharedChunkTestRangeMap = sparse_container::shared_chunk_range_map<uint64_t, uint32_t>;
+
+namespace {
+
+// Generates the given ranges in order, with the same interface as the image range generators
+class VectorRangeGen {
+  public:
+    using RangeType = TestRange;
+    VectorRangeGen(const std::vector<TestRange> &ranges) : ranges_(ranges) {}
+    const TestRange &operator*() const { return Current(); }
+    const TestRange *operator->() const { return &Current(); }
+    VectorRangeGen &operator++() {
+        ++index_;
+        return *this;
+    }
+
+  private:
+    const TestRange &Current() const { return index_ < ranges_.size() ? ranges_[index_] : empty_; }
+    const std::vector<TestRange> &ranges_;
+    size_t index_ = 0;
+    const TestRange empty_;
+};
+
+// Infills with 0, then counts the updates of each entry
+template <typename Map = TestRangeMap>
+struct CountUpdatesOps {
+    void infill(Map &map, const typename Map::iterator &pos, const TestRange &range) const {
+        auto inserted = map.insert(pos, std::make_pair(range, 0u));
+        ++inserted->second;
+    }
+    void update(const typename Map::iterator &pos) const { ++pos->second; }
+};
+
+template <typename Map = TestRangeMap>
+Map MakeStripedMap(uint64_t count, uint64_t stride, uint64_t size) {
+    Map map;
+    for (uint64_t i = 0; i < count; ++i) {
+        map.insert(std::make_pair(TestRange(i * stride, i * stride + size), 0u));
+    }
+    return map;
+}
+
+}  // namespace
+
+TEST(CustomContainer, RangeMapSeekLowerBound) {
+    const TestRangeMap map = MakeStripedMap(64, 16, 8);
+    for (uint64_t from = 0; from < 64; ++from) {
+        const auto from_pos = map.lower_bound(TestRange(from * 16, from * 16 + 1));
+        for (uint64_t to = from * 16; to < 64 * 16; to += 5) {
+            const TestRange range(to, to + 3);
+            ASSERT_TRUE(sparse_container::seek_lower_bound(map, from_pos, range) == map.lower_bound(range));
+        }
+    }
+}
+
+TEST(CustomContainer, RangeMapInfillUpdateRangeGen) {
+    // Sorted ranges that are near to each other, far apart, and abutting
+    const std::vector<TestRange> ranges = {{2, 6}, {10, 12}, {100, 140}, {140, 164}, {164, 170}, {900, 1000}};
+
+    TestRangeMap batched = MakeStripedMap(64, 16, 8);
+    VectorRangeGen range_gen(ranges);
+    sparse_container::infill_update_rangegen(batched, range_gen, CountUpdatesOps<>());
+
+    TestRangeMap single = MakeStripedMap(64, 16, 8);
+    for (const auto &range : ranges) {
+        sparse_container::infill_update_range(single, range, CountUpdatesOps<>());
+    }
+
+    // Each address of the generated ranges is updated exactly once, and nothing else is touched
+    for (uint64_t address = 0; address < 1024; ++address) {
+        const auto batched_it = batched.find(address);
+        const auto single_it = single.find(address);
+        ASSERT_EQ(batched_it == batched.end(), single_it == single.end());
+        if (batched_it != batched.end()) {
+            ASSERT_EQ(batched_it->second, single_it->second);
+        }
+    }
+
+    // Abutting ranges don't split the entries spanning them
+    ASSERT_LT(batched.size(), single.size());
+    const auto spanning = batched.find(150);
+    ASSERT_TRUE(spanning != batched.end());
+    ASSERT_EQ(spanning->first, TestRange(144, 152));
+}
+
+template <typename MapA, typename MapB>
+void ExpectSameEntries(const MapA &a, const MapB &b) {
+    ASSERT_EQ(a.size(), b.size());
+    auto b_it = b.begin();
+    for (const auto &entry : a) {
+        ASSERT_EQ(entry.first, b_it->first);
+        ASSERT_EQ(entry.second, b_it->second);
+        ++b_it;
+    }
+}
+
+// The modifications the sync maps make, op picks one of them, ranges is used by the range generator update
+template <typename Map>
+void ApplyRandomOp(Map &map, uint32_t op, const TestRange &range, uint32_t value, const std::vector<TestRange> &ranges) {
+    switch (op % 5) {
+        case 0:
+            map.insert(std::make_pair(range, value));
+            break;
+        case 1:
+            map.overwrite_range(std::make_pair(range, value));
+            break;
+        case 2:
+            map.erase_range(range);
+            break;
+        case 3:
+            sparse_container::infill_update_range(map, range, CountUpdatesOps<Map>());
+            break;
+        default: {
+            VectorRangeGen gen(ranges);
+            sparse_container::infill_update_rangegen(map, gen, CountUpdatesOps<Map>());
+            break;
+        }
+    }
+}
+
+std::vector<TestRange> RandomStripes(std::mt19937 &random, uint64_t begin, uint64_t limit) {
+    std::vector<TestRange> ranges;
+    for (; begin < limit; begin += 16 + random() % 64) {
+        ranges.emplace_back(begin, begin + 1 + random() % 16);
+    }
+    return ranges;
+}
+
+TEST(CustomContainer, RangeMapFlatMatchesTree) {
+    std::mt19937 random(42);
+    auto random_range = [&random]() {
+        const uint64_t begin = random() % 4096;
+        return TestRange(begin, begin + 1 + random() % 256);
+    };
+
+    TestRangeMap tree = MakeStripedMap(64, 64, 32);
+    FlatTestRangeMap flat = MakeStripedMap<FlatTestRangeMap>(64, 64, 32);
+    for (uint32_t i = 0; i < 2000; ++i) {
+        const TestRange range = random_range();
+        const uint32_t op = random();
+        const std::vector<TestRange> ranges = RandomStripes(random, range.begin, 4096);
+        ApplyRandomOp(tree, op, range, i, ranges);
+        ApplyRandomOp(flat, op, range, i, ranges);
+        ExpectSameEntries(tree, flat);
+        const uint64_t index = random() % 4096;
+        ASSERT_EQ(tree.find(index) == tree.end(), flat.find(index) == flat.end());
+    }
+}
+
+// Copies share their chunks, so check that modifying either the original or the copy leaves the other unchanged
+TEST(CustomContainer, RangeMapSharedChunkMatchesTree) {
+    std::mt19937 random(7);
+    constexpr uint64_t kLimit = 64 * 1024;
+    auto random_range = [&random]() {
+        const uint64_t begin = random() % kLimit;
+        return TestRange(begin, begin + 1 + random() % 1024);
+    };
+
+    std::vector<TestRangeMap> trees;
+    std::vector<SharedChunkTestRangeMap> shared;
+    trees.emplace_back(MakeStripedMap(2048, 32, 16));
+    shared.emplace_back(MakeStripedMap<SharedChunkTestRangeMap>(2048, 32, 16));
+    for (uint32_t i = 0; i < 4000; ++i) {
+        if (random() % 64 == 0) {
+            const size_t source = random() % trees.size();
+            TestRangeMap tree_copy(trees[source]);
+            SharedChunkTestRangeMap shared_copy(shared[source]);
+            trees.emplace_back(std::move(tree_copy));
+            shared.emplace_back(std::move(shared_copy));
+        }
+        const size_t target = random() % trees.size();
+        const TestRange range = random_range();
+        const uint32_t op = random();
+        const std::vector<TestRange> ranges = RandomStripes(random, range.begin, std::min(range.begin + 4096, kLimit));
+        ApplyRandomOp(trees[target], op, range, i, ranges);
+        ApplyRandomOp(shared[target], op, range, i, ranges);
+        const uint64_t index = random() % kLimit;
+        ASSERT_EQ(trees[target].find(index) == trees[target].end(), shared[target].find(index) == shared[target].end());
+    }
+    for (size_t i = 0; i < trees.size(); ++i) {
+        ExpectSameEntries(trees[i], shared[i]);
+        // Walk backwards through the non-const iterators too, which copy the shared chunks they visit
+        auto tree_pos = trees[i].end();
+        auto shared_pos = shared[i].end();
+        while (tree_pos != trees[i].begin()) {
+            --tree_pos;
+            --shared_pos;
+            ASSERT_EQ(tree_pos->first, shared_pos->first);
+        }
+        ASSERT_TRUE(shared_pos == shared[i].begin());
+    }
+}
+
+// The queue batches copy the map of the previous batch, then update the ranges their command buffers access. Only the
+// chunks holding these ranges should be copied.
+TEST(CustomContainer, RangeMapSharedChunkBatchCopy) {
+    constexpr uint64_t kEntries = 64 * 1024;
+    SharedChunkTestRangeMap previous = MakeStripedMap<SharedChunkTestRangeMap>(kEntries, 32, 16);
+    // The map grows as a single chunk while it isn't shared, the first copy splits it
+    {
+        SharedChunkTestRangeMap first(previous);
+        first.overwrite_range(std::make_pair(TestRange(0, 16), 1u));
+    }
+
+    for (uint32_t batch = 0; batch < 16; ++batch) {
+        SharedChunkTestRangeMap next(previous);
+        const auto copies = next.get_implementation_map().chunk_copies();
+        const std::vector<uint64_t> accessed = {0, kEntries * 16, (kEntries - 1) * 32};
+        for (const uint64_t begin : accessed) {
+            sparse_container::infill_update_range(next, TestRange(begin, begin + 64), CountUpdatesOps<SharedChunkTestRangeMap>());
+        }
+        // An update can straddle two chunks
+        ASSERT_LE(next.get_implementation_map().chunk_copies() - copies, 2 * accessed.size());
+
+        for (const uint64_t begin : accessed) {
+            const auto pos = next.find(begin);
+            ASSERT_TRUE(pos != next.end());
+            ASSERT_EQ(pos->second, 1u + batch);
+            ASSERT_EQ(std::as_const(previous).find(begin)->second, batch);
+        }
+        previous = std::move(next);
+    }
+}
+
+// Copies sharing chunks can be modified and destroyed by different threads
+TEST(CustomContainer, RangeMapSharedChunkThreads) {
+    constexpr uint32_t kThreads = 4;
+    const SharedChunkTestRangeMap source = MakeStripedMap<SharedChunkTestRangeMap>(4096, 32, 16);
+    const TestRangeMap expected_source = MakeStripedMap(4096, 32, 16);
+    std::vector<SharedChunkTestRangeMap> copies(kThreads, source);
+
+    std::vector<std::thread> threads;
+    std::vector<TestRangeMap> expected(kThreads, expected_source);
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t, &copies, &expected]() {
+            std::mt19937 random(t);
+            for (uint32_t i = 0; i < 1000; ++i) {
+                const uint64_t begin = random() % (4096 * 32);
+                const TestRange range(begin, begin + 1 + random() % 256);
+                const uint32_t op = random();
+                const std::vector<TestRange> ranges = RandomStripes(random, begin, begin + 1024);
+                ApplyRandomOp(copies[t], op, range, i, ranges);
+                ApplyRandomOp(expected[t], op, range, i, ranges);
+            }
+            if (t % 2) {
+                copies[t].clear();
+                expected[t].clear();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ExpectSameEntries(expected_source, source);
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        ExpectSameEntries(expected[t], copies[t]);
+    }
+}
+
+// Microbenchmark of the range_map backends, with the access patterns of the maps built on them. Run with
+// --gtest_also_run_disabled_tests --gtest_filter=*RangeMapBenchmark* --gtest_output=xml:<file>
+namespace {
+constexpr uint64_t kBenchmarkEntries = 64 * 1024;
+constexpr uint32_t kBenchmarkRepeats = 16;
+
+template <typename Map>
+void RunRangeMapBenchmark(const std::string &name) {
+    uint64_t checksum = 0;
+
+    // Access state of an image, one entry per subresource, built by copies in address order
+    Map map;
+    const double build_ms = benchmark::TimeMs([&map]() {
+        for (uint64_t i = 0; i < kBenchmarkEntries; ++i) {
+            map.insert(map.end(), std::make_pair(TestRange(i * 256, i * 256 + 192), 0u));
+        }
+    });
+
+    // Barriers on one array layer of each mip, walking the map as a sorted stream of ranges
+    std::vector<TestRange> barrier_ranges;
+    for (uint64_t i = 0; i < kBenchmarkEntries; i += 64) {
+        barrier_ranges.emplace_back(i * 256, i * 256 + 192);
+    }
+    struct UpdateOnlyOps {
+        void infill(Map &, const typename Map::iterator &, const TestRange &) const {}
+        void update(const typename Map::iterator &pos) const { ++pos->second; }
+    };
+    const double barrier_ms = benchmark::TimeMs([&]() {
+        for (uint32_t r = 0; r < kBenchmarkRepeats * 16; ++r) {
+            VectorRangeGen range_gen(barrier_ranges);
+            sparse_container::infill_update_rangegen(map, range_gen, UpdateOnlyOps());
+        }
+    });
+
+    // Hazard lookups and address lookups, at scattered addresses
+    const double lookup_ms = benchmark::TimeMs([&]() {
+        for (uint64_t i = 0; i < kBenchmarkEntries * kBenchmarkRepeats; ++i) {
+            const auto found = std::as_const(map).find(((i * 2654435761u) % kBenchmarkEntries) * 256 + 17);
+            checksum += (found != map.cend()) ? found->second : 0;
+        }
+    });
+
+    // Full walks, as done by resolves and trims
+    const double walk_ms = benchmark::TimeMs([&]() {
+        for (uint32_t r = 0; r < kBenchmarkRepeats; ++r) {
+            for (const auto &entry : std::as_const(map)) {
+                checksum += entry.second;
+            }
+        }
+    });
+
+    // Trimming the front of a log, as queue submits retire old batches
+    const double trim_ms = benchmark::TimeMs([&map]() {
+        while (!map.empty()) {
+            auto first = map.begin();
+            auto last = map.lower_bound(TestRange(first->first.begin + 256 * 64, first->first.begin + 256 * 64 + 1));
+            map.erase(first, last);
+        }
+    });
+
+    benchmark::KeepAlive(checksum);
+    benchmark::RecordMs(name + "_build_ms", build_ms);
+    benchmark::RecordMs(name + "_barriers_ms", barrier_ms);
+    benchmark::RecordMs(name + "_lookups_ms", lookup_ms);
+    benchmark::RecordMs(name + "_walks_ms", walk_ms);
+    benchmark::RecordMs(name + "_trims_ms", trim_ms);
+}
+}  // namespace
+
+TEST(CustomContainer, DISABLED_RangeMapBenchmark) {
+    RunRangeMapBenchmark<TestRangeMap>("range_map");
+    RunRangeMapBenchmark<FlatTestRangeMap>("flat_range_map");
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "../framework/benchmark_helper.h"
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/slot_map.h"
+
+TEST(CustomContainer, SlotMapInsertFindPop) {
+    vvl::concurrent_slot_map<uint64_t> map;
+    const uint64_t key_a = map.insert(100);
+    const uint64_t key_b = map.insert(200);
+    ASSERT_NE(key_a, 0u);
+    ASSERT_NE(key_b, 0u);
+    ASSERT_NE(key_a, key_b);
+    ASSERT_EQ(map.size(), 2u);
+
+    auto iter = map.find(key_a);
+    ASSERT_TRUE(iter != map.end());
+    ASSERT_EQ(iter->second, 100u);
+
+    map.insert_or_assign(key_b, 300);
+    ASSERT_EQ(map.find(key_b)->second, 300u);
+
+    auto popped = map.pop(key_a);
+    ASSERT_TRUE(popped != map.end());
+    ASSERT_EQ(popped->second, 100u);
+    ASSERT_TRUE(map.find(key_a) == map.end());
+    ASSERT_TRUE(map.pop(key_a) == map.end());
+    ASSERT_EQ(map.size(), 1u);
+
+    // Unknown keys, including ones pointing past any allocated slot, are not found
+    ASSERT_TRUE(map.find(0) == map.end());
+    ASSERT_TRUE(map.find(0xFFFFFFFFull) == map.end());
+    ASSERT_TRUE(map.find(key_b + (uint64_t(1) << 32)) == map.end());
+}
+
+TEST(CustomContainer, SlotMapRecycledSlotsGetNewKeys) {
+    vvl::concurrent_slot_map<uint64_t> map;
+    const uint64_t old_key = map.insert(1);
+    map.erase(old_key);
+    const uint64_t new_key = map.insert(2);
+
+    // Same slot, different generation
+    ASSERT_EQ(old_key & 0xFFFFFFFFull, new_key & 0xFFFFFFFFull);
+    ASSERT_NE(old_key, new_key);
+    ASSERT_TRUE(map.find(old_key) == map.end());
+    ASSERT_EQ(map.find(new_key)->second, 2u);
+}
+
+TEST(CustomContainer, SlotMapAttachments) {
+    vvl::concurrent_slot_map<uint64_t> map;
+    int data_a = 0;
+    int data_b = 0;
+    const uint64_t key = map.insert(1);
+    ASSERT_TRUE(map.find_attachment(key) == nullptr);
+    ASSERT_TRUE(map.attach(key, &data_a));
+    ASSERT_TRUE(map.find_attachment(key) == &data_a);
+
+    // Only the given attachment is detached
+    map.detach(key, &data_b);
+    ASSERT_TRUE(map.find_attachment(key) == &data_a);
+    map.detach(key, &data_a);
+    ASSERT_TRUE(map.find_attachment(key) == nullptr);
+
+    // Erasing clears the attachment, the recycled slot starts without one
+    ASSERT_TRUE(map.attach(key, &data_a));
+    map.erase(key);
+    ASSERT_TRUE(map.find_attachment(key) == nullptr);
+    ASSERT_FALSE(map.attach(key, &data_b));
+    const uint64_t new_key = map.insert(2);
+    ASSERT_EQ(key & 0xFFFFFFFFull, new_key & 0xFFFFFFFFull);
+    ASSERT_TRUE(map.find_attachment(new_key) == nullptr);
+}
+
+TEST(CustomContainer, SlotMapConcurrentInsertErase) {
+    vvl::concurrent_slot_map<uint64_t, 4> map;  // small segments to exercise segment allocation
+    constexpr uint32_t kThreads = 8;
+    constexpr uint32_t kPerThread = 2000;
+    std::vector<std::thread> threads;
+    std::vector<std::vector<uint64_t>> keys(kThreads);
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&map, &keys, t]() {
+            for (uint32_t i = 0; i < kPerThread; ++i) {
+                const uint64_t value = (uint64_t(t) << 32) | i;
+                keys[t].push_back(map.insert(value));
+                if (i % 3 == 0) {
+                    map.erase(keys[t].back());
+                    keys[t].back() = 0;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    size_t live = 0;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        for (uint32_t i = 0; i < kPerThread; ++i) {
+            if (keys[t][i] == 0) continue;
+            auto iter = map.find(keys[t][i]);
+            ASSERT_TRUE(iter != map.end());
+            ASSERT_EQ(iter->second, (uint64_t(t) << 32) | i);
+            ++live;
+        }
+    }
+    ASSERT_EQ(map.size(), live);
+}
+
+// Microbenchmark of handle unwrapping, comparing the two unique_id_mapping backends with N threads looking up handles
+// the way command recording does. Run with --gtest_also_run_disabled_tests --gtest_filter=*SlotMapBenchmark*
+// --gtest_output=xml:<file>
+namespace {
+constexpr uint32_t kBenchmarkHandles = 4096;
+constexpr uint32_t kBenchmarkLookupsPerThread = 4 * 1024 * 1024;
+
+template <typename Lookup>
+double TimeConcurrentLookups(uint32_t thread_count, Lookup &&lookup) {
+    return benchmark::TimeMs([&]() {
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&lookup, t]() {
+                uint64_t checksum = 0;
+                for (uint32_t i = 0; i < kBenchmarkLookupsPerThread; ++i) {
+                    checksum += lookup((i * 7 + t) % kBenchmarkHandles);
+                }
+                benchmark::KeepAlive(checksum);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    });
+}
+}  // namespace
+
+TEST(CustomContainer, DISABLED_SlotMapBenchmark) {
+    vvl::concurrent_unordered_map<uint64_t, uint64_t, 4> hash_map;
+    vvl::concurrent_slot_map<uint64_t> slot_map;
+    std::vector<uint64_t> hash_keys;
+    std::vector<uint64_t> slot_keys;
+    for (uint64_t i = 0; i < kBenchmarkHandles; ++i) {
+        const uint64_t key = (vvl::hash<uint64_t>()(i + 1) << 40) | (i + 1);
+        hash_map.insert_or_assign(key, i);
+        hash_keys.push_back(key);
+        slot_keys.push_back(slot_map.insert(i));
+    }
+
+    const uint32_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        const double hash_ms =
+            TimeConcurrentLookups(thread_count, [&](uint32_t i) { return hash_map.find(hash_keys[i])->second; });
+        const double slot_ms =
+            TimeConcurrentLookups(thread_count, [&](uint32_t i) { return slot_map.find(slot_keys[i])->second; });
+        const std::string threads = std::to_string(thread_count) + "_threads";
+        benchmark::RecordMs("concurrent_unordered_map_" + threads + "_ms", hash_ms);
+        benchmark::RecordMs("concurrent_slot_map_" + threads + "_ms", slot_ms);
+    }
+}